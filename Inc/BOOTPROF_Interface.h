@@ -0,0 +1,115 @@
+/**
+ * @file BOOTPROF_Interface.h
+ * @brief Interface for the boot-time interrupt readiness profiler.
+ *
+ * This file provides a profiler that stamps every NVIC enable and priority change made
+ * during initialisation with the cycle count since reset, and groups them into a per
+ * subsystem timeline. It shows which initialisation steps delay the moment each
+ * interrupt becomes ready.
+ *
+ * The NVIC driver calls BOOTPROF_Hook() when built with NVIC_BOOTPROF defined; without it
+ * the driver carries no profiling code. Call BOOTPROF_Start() first thing in the reset
+ * handler, BOOTPROF_Subsystem() before each subsystem's initialisation and BOOTPROF_Finish()
+ * once the system is up.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef BOOTPROF_INTERFACE_H
+#define BOOTPROF_INTERFACE_H
+
+#include <stdint.h>
+#include "NVIC_Interface.h"
+
+#ifndef BOOTPROF_MAX_RECORDS
+#define BOOTPROF_MAX_RECORDS       64U
+#endif
+#ifndef BOOTPROF_MAX_SUBSYSTEMS
+#define BOOTPROF_MAX_SUBSYSTEMS    16U
+#endif
+
+/**
+ * @enum BOOTPROF_Event_t
+ * @brief NVIC call recorded.
+ */
+typedef enum
+{
+    BOOTPROF_EVENT_ENABLE = 0U,    /**< IRQ enabled; Value is 0 */
+    BOOTPROF_EVENT_PRIORITY        /**< Priority set; Value is the priority */
+} BOOTPROF_Event_t;
+
+/**
+ * @struct BOOTPROF_Record_t
+ * @brief One recorded NVIC call.
+ */
+typedef struct
+{
+    uint32_t Cycles;       /**< Cycles since BOOTPROF_Start() */
+    uint8_t  Event;        /**< BOOTPROF_Event_t */
+    uint8_t  IRQn;
+    uint8_t  Value;
+    uint8_t  Subsystem;    /**< Index in the timeline */
+} BOOTPROF_Record_t;
+
+/**
+ * @struct BOOTPROF_Subsystem_t
+ * @brief Timeline entry of one subsystem's initialisation.
+ */
+typedef struct
+{
+    const char* Name;
+    uint32_t Begin;        /**< Cycles at BOOTPROF_Subsystem() */
+    uint32_t End;          /**< Cycles when the next subsystem began or BOOTPROF_Finish() ran */
+    uint32_t FirstEnable;  /**< Cycles at its first IRQ enable, 0 when none */
+    uint32_t LastEnable;   /**< Cycles at its last IRQ enable: the subsystem is interrupt-ready */
+    uint16_t Enables;
+    uint16_t Priorities;
+} BOOTPROF_Subsystem_t;
+
+/**
+ * @brief Starts the cycle counter from zero; call it first thing in the reset handler.
+ *
+ * Uses no RAM, so it may run before the startup code initialises .data and .bss.
+ */
+void BOOTPROF_Start(void);
+
+/**
+ * @brief Opens the timeline entry of a subsystem, closing the previous one.
+ *
+ * @param[in] Name  Subsystem name, kept by pointer.
+ */
+void BOOTPROF_Subsystem(const char* Name);
+
+/**
+ * @brief Records an NVIC call; called by the NVIC driver.
+ */
+void BOOTPROF_Hook(BOOTPROF_Event_t Event, IRQn_Type IRQn, uint32_t Value);
+
+/**
+ * @brief Closes the timeline and stops recording.
+ *
+ * @return uint32_t Cycles from reset to the end of the boot.
+ */
+uint32_t BOOTPROF_Finish(void);
+
+/**
+ * @brief Returns the recorded NVIC calls.
+ *
+ * @param[out] Count    Number of records.
+ * @param[out] Dropped  Calls not recorded once the record table was full, may be NULL.
+ * @return const BOOTPROF_Record_t* The records, oldest first.
+ */
+const BOOTPROF_Record_t* BOOTPROF_GetRecords(uint32_t* Count, uint32_t* Dropped);
+
+/**
+ * @brief Returns the per-subsystem timeline.
+ *
+ * Calls made before the first BOOTPROF_Subsystem() are charged to an entry named "boot".
+ *
+ * @param[out] Count  Number of entries.
+ * @return const BOOTPROF_Subsystem_t* The entries, in boot order.
+ */
+const BOOTPROF_Subsystem_t* BOOTPROF_GetTimeline(uint32_t* Count);
+
+#endif /* BOOTPROF_INTERFACE_H */
@@ -0,0 +1,6 @@
+#ifndef BOOTPROF_PRIVATE_H
+#define BOOTPROF_PRIVATE_H
+
+#define BOOTPROF_DEFAULT_NAME    "boot"   /**< Entry of the calls made before the first subsystem */
+
+#endif /*BOOTPROF_PRIVATE_H*/
@@ -0,0 +1,85 @@
+/**
+ * @file CALIB_Interface.h
+ * @brief Interface for the interrupt latency calibration.
+ *
+ * This file provides a routine that measures the interrupt latencies of the running
+ * board and clock setup. Two reserved IRQs are triggered through STIR at each of the 16
+ * priority levels and timed with the DWT cycle counter:
+ *   - Entry:     from the STIR write in thread mode to the handler
+ *   - Preempt:   from the STIR write in a lower-priority handler to the preempting handler
+ *   - TailChain: from the end of one handler to the next handler of the same level
+ * The cost of reading the cycle counter is measured and subtracted. The results include
+ * the compiler's handler prologue: they are the latencies a C handler actually sees.
+ *
+ * The two IRQs (CALIB_IRQ_PROBE and CALIB_IRQ_CHAIN) must have no peripheral in use and
+ * their vectors must call CALIB_ProbeHandler() and CALIB_ChainHandler().
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef CALIB_INTERFACE_H
+#define CALIB_INTERFACE_H
+
+#include <stdint.h>
+#include "NVIC_Interface.h"
+
+#ifndef CALIB_IRQ_PROBE
+#define CALIB_IRQ_PROBE     SPDIF_Rx    /**< IRQ taken at the measured level */
+#define CALIB_IRQ_CHAIN     HDMI_CEC    /**< IRQ preempted by, or tail-chained to, the probe */
+#endif
+
+#define CALIB_LEVELS        16U
+
+/**
+ * @struct CALIB_Stat_t
+ * @brief Latency samples of one case at one level, in CPU cycles.
+ */
+typedef struct
+{
+    uint32_t Min;        /**< Best case: the latency with no other interrupt in the way */
+    uint32_t Max;
+    uint32_t Sum;        /**< Sum / Count gives the mean */
+    uint32_t Count;      /**< Samples taken, 0 when the case does not exist at this level */
+} CALIB_Stat_t;
+
+/**
+ * @struct CALIB_Results_t
+ * @brief Latencies per priority level.
+ */
+typedef struct
+{
+    CALIB_Stat_t Entry[CALIB_LEVELS];
+    CALIB_Stat_t Preempt[CALIB_LEVELS];      /**< None at level 15, nothing is lower */
+    CALIB_Stat_t TailChain[CALIB_LEVELS];
+    uint32_t Overhead;                       /**< Cycles of a back-to-back CYCCNT read pair, subtracted */
+    uint32_t Lost;                           /**< Triggers whose handler never ran */
+} CALIB_Results_t;
+
+/**
+ * @brief Measures every case at every level.
+ *
+ * Call it from thread mode with interrupts unmasked. The two reserved IRQs get back
+ * their priority and enable state afterwards; BASEPRI is cleared for the run and restored.
+ *
+ * @param[in] Samples  Samples per case and level.
+ * @return uint8_t OK, NOK when called from a handler, with PRIMASK set or with lost triggers.
+ */
+uint8_t CALIB_Run(uint32_t Samples);
+
+/**
+ * @brief Returns the results of the last CALIB_Run().
+ */
+const CALIB_Results_t* CALIB_GetResults(void);
+
+/**
+ * @brief Body of the CALIB_IRQ_PROBE handler; call it first thing in that vector.
+ */
+void CALIB_ProbeHandler(void);
+
+/**
+ * @brief Body of the CALIB_IRQ_CHAIN handler; call it first thing in that vector.
+ */
+void CALIB_ChainHandler(void);
+
+#endif /* CALIB_INTERFACE_H */
@@ -0,0 +1,19 @@
+#ifndef CALIB_PRIVATE_H
+#define CALIB_PRIVATE_H
+
+#define CALIB_WAIT_LIMIT       1000U    /**< Polls for a handler that should run within cycles */
+#define CALIB_OVERHEAD_RUNS    16U
+
+/**
+ * @enum CALIB_Mode_t
+ * @brief Case being measured, selecting what the handlers do.
+ */
+typedef enum
+{
+    CALIB_MODE_IDLE = 0U,
+    CALIB_MODE_ENTRY,            /**< Probe: stamps its entry */
+    CALIB_MODE_PREEMPT,          /**< Chain: stamps and triggers the probe; probe: stamps its entry */
+    CALIB_MODE_TAIL              /**< Probe: triggers the chain, stamps its end; chain: stamps its entry */
+} CALIB_Mode_t;
+
+#endif /*CALIB_PRIVATE_H*/
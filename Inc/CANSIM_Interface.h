@@ -0,0 +1,210 @@
+/**
+ * @file CANSIM_Interface.h
+ * @brief Interface for the host simulation of a fleet of CAN nodes.
+ *
+ * This file provides a harness that runs hundreds of simulated MCUs, each with its own
+ * NVIC_Model_t and bxCAN-like CAN1_RX0 (3-frame FIFO 0) and CAN1_TX (3 mailboxes)
+ * interrupt flow, on a pool of threads sharing one simulated bus. Time advances in ticks.
+ * During a tick every node takes the interrupts raised by the previous tick, runs its
+ * thread-mode code and offers its most urgent mailbox to the bus; the offers are appended
+ * lock-free. Between two ticks one thread arbitrates (lowest identifier first, within the
+ * bit budget of the tick) and every node then reads the winning frames on its own, one by
+ * one, taking the interrupts raised by each frame before the next one arrives.
+ * Nodes never share state otherwise, so the run scales with the number of cores.
+ *
+ * Host builds compile CANSIM_Program.c with NVIC_Model_Program.c and link with -pthread.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef CANSIM_INTERFACE_H
+#define CANSIM_INTERFACE_H
+
+#include <stdint.h>
+#include "NVIC_Model_Interface.h"
+
+#define CANSIM_FIFO_DEPTH          3U    /**< Receive FIFO 0 depth, as on bxCAN */
+#define CANSIM_MAILBOXES           3U    /**< Transmit mailboxes, as on bxCAN */
+#define CANSIM_MAX_WINNERS         64U   /**< Frames carried by the bus in one tick, at most */
+
+/**
+ * @struct CANSIM_Frame_t
+ * @brief Data frame with an 11-bit identifier.
+ */
+typedef struct
+{
+    uint32_t Id;          /**< Identifier, lower value wins arbitration */
+    uint8_t  Dlc;         /**< Data length 0-8 */
+    uint8_t  Data[8];
+    uint16_t Sender;      /**< Index of the transmitting node, filled by the bus */
+} CANSIM_Frame_t;
+
+/**
+ * @struct CANSIM_NodeStats_t
+ * @brief Per-node counters, the interrupt rates are these counts over the simulated time.
+ */
+typedef struct
+{
+    uint32_t RxIrqs;            /**< CAN1_RX0 handler runs */
+    uint32_t TxIrqs;            /**< CAN1_TX handler runs */
+    uint32_t FramesSent;        /**< Frames that won arbitration */
+    uint32_t FramesReceived;    /**< Frames stored in FIFO 0 */
+    uint32_t ArbitrationLost;   /**< Ticks a mailbox was offered and not sent */
+    uint32_t RxOverruns;        /**< Frames lost to a full FIFO 0 */
+    uint32_t FilteredOut;       /**< Frames rejected by the acceptance filter */
+} CANSIM_NodeStats_t;
+
+typedef struct CANSIM_Node CANSIM_Node_t;
+typedef struct CANSIM_Sim CANSIM_Sim_t;
+
+/**
+ * @struct CANSIM_App_t
+ * @brief Firmware of the simulated nodes, shared by every node.
+ *
+ * RxIrq must release the frames it handles with CANSIM_Receive(): CAN1_RX0 stays pending
+ * while FIFO 0 holds a frame, as on the hardware.
+ */
+typedef struct
+{
+    void (*Tick)(CANSIM_Node_t* Node, uint32_t Tick);   /**< Thread-mode code, once per tick */
+    void (*RxIrq)(CANSIM_Node_t* Node);                 /**< CAN1_RX0 handler */
+    void (*TxIrq)(CANSIM_Node_t* Node);                 /**< CAN1_TX handler, once per sent frame */
+} CANSIM_App_t;
+
+/**
+ * @struct CANSIM_Node
+ * @brief One simulated MCU.
+ */
+struct CANSIM_Node
+{
+    uint32_t Index;                            /**< Position in the fleet */
+    void* Context;                             /**< Free for the firmware */
+    NVIC_Model_t Nvic;                         /**< The node's own NVIC */
+    uint32_t FilterId;                         /**< Accepted when (Id & FilterMask) == FilterId */
+    uint32_t FilterMask;                       /**< 0 accepts every frame */
+    CANSIM_Frame_t Fifo[CANSIM_FIFO_DEPTH];
+    uint8_t FifoHead;
+    uint8_t FifoCount;
+    CANSIM_Frame_t Mailbox[CANSIM_MAILBOXES];
+    uint8_t MailboxBusy;                       /**< One bit per mailbox waiting for the bus */
+    CANSIM_NodeStats_t Stats;
+    CANSIM_Sim_t* Sim;
+};
+
+/**
+ * @struct CANSIM_Config_t
+ * @brief Fleet and bus parameters.
+ */
+typedef struct
+{
+    uint32_t NodeCount;          /**< Simulated MCUs */
+    uint32_t ThreadCount;        /**< Worker threads, the caller being one of them */
+    uint32_t BitRate;            /**< Bus bit rate in bit/s */
+    uint32_t TickUs;             /**< Simulated time per tick in microseconds */
+    uint8_t RxPriority;          /**< NVIC priority of CAN1_RX0 on every node */
+    uint8_t TxPriority;          /**< NVIC priority of CAN1_TX on every node */
+    const CANSIM_App_t* App;     /**< Firmware */
+} CANSIM_Config_t;
+
+/**
+ * @struct CANSIM_Offer_t
+ * @brief Mailbox offered to the bus for the current tick.
+ */
+typedef struct
+{
+    CANSIM_Frame_t Frame;
+    uint8_t Mailbox;
+} CANSIM_Offer_t;
+
+/**
+ * @struct CANSIM_Sim
+ * @brief Fleet, bus and thread pool state.
+ */
+struct CANSIM_Sim
+{
+    CANSIM_Config_t Config;
+    CANSIM_Node_t* Nodes;
+    CANSIM_Offer_t* Offers;                          /**< One slot per node and tick */
+    volatile uint32_t OfferCount;                    /**< Slots claimed this tick */
+    CANSIM_Offer_t Winners[CANSIM_MAX_WINNERS];      /**< Frames carried by the last tick */
+    uint32_t WinnerCount;
+    uint32_t BitsPerTick;
+    uint32_t Budget;                                 /**< Bits left, carried over by one frame at most */
+    uint64_t BusBits;                                /**< Bits carried since creation */
+    uint64_t Ticks;                                  /**< Ticks simulated since creation */
+    uint32_t RunTicks;                               /**< Length of the current CANSIM_Run() */
+    void* Barrier;                                   /**< pthread_barrier_t of the thread pool */
+};
+
+/**
+ * @brief Allocates the fleet and configures every node's NVIC.
+ *
+ * @param[out] Sim     Simulation to create.
+ * @param[in]  Config  Parameters, copied.
+ * @return uint8_t OK on success, NULL_PTR_ERR on a NULL argument, NOK on a bad parameter
+ *                 or when memory is exhausted.
+ */
+uint8_t CANSIM_Create(CANSIM_Sim_t* Sim, const CANSIM_Config_t* Config);
+
+/**
+ * @brief Frees a simulation created by CANSIM_Create().
+ *
+ * @param[in,out] Sim  Simulation.
+ */
+void CANSIM_Destroy(CANSIM_Sim_t* Sim);
+
+/**
+ * @brief Simulates a number of ticks on the thread pool, returning when they are done.
+ *
+ * @param[in,out] Sim    Simulation.
+ * @param[in]     Ticks  Ticks to simulate.
+ * @return uint8_t OK on success, NULL_PTR_ERR on a NULL argument, NOK when a thread cannot start.
+ */
+uint8_t CANSIM_Run(CANSIM_Sim_t* Sim, uint32_t Ticks);
+
+/**
+ * @brief Returns a node of the fleet.
+ *
+ * @param[in] Sim    Simulation.
+ * @param[in] Index  Node index.
+ * @return CANSIM_Node_t* The node, NULL when Index is out of range.
+ */
+CANSIM_Node_t* CANSIM_GetNode(CANSIM_Sim_t* Sim, uint32_t Index);
+
+/**
+ * @brief Sets a node's acceptance filter.
+ *
+ * @param[in,out] Node  Node.
+ * @param[in]     Id    Identifier bits to match.
+ * @param[in]     Mask  Identifier bits compared, 0 accepts every frame.
+ */
+void CANSIM_SetFilter(CANSIM_Node_t* Node, uint32_t Id, uint32_t Mask);
+
+/**
+ * @brief Places a frame in a free transmit mailbox of the calling node.
+ *
+ * @param[in,out] Node   Node.
+ * @param[in]     Frame  Frame to send.
+ * @return uint8_t OK on success, NULL_PTR_ERR on a NULL argument, NOK when every mailbox is busy.
+ */
+uint8_t CANSIM_Transmit(CANSIM_Node_t* Node, const CANSIM_Frame_t* Frame);
+
+/**
+ * @brief Reads and releases the oldest frame of FIFO 0.
+ *
+ * @param[in,out] Node   Node.
+ * @param[out]    Frame  Received frame.
+ * @return uint8_t OK on success, NULL_PTR_ERR on a NULL argument, NOK when the FIFO is empty.
+ */
+uint8_t CANSIM_Receive(CANSIM_Node_t* Node, CANSIM_Frame_t* Frame);
+
+/**
+ * @brief Returns the bus load since creation, in per mille of the bit budget.
+ *
+ * @param[in] Sim  Simulation.
+ * @return uint32_t Bus load 0-1000.
+ */
+uint32_t CANSIM_GetBusLoad(const CANSIM_Sim_t* Sim);
+
+#endif /* CANSIM_INTERFACE_H */
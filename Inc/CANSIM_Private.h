@@ -0,0 +1,11 @@
+#ifndef CANSIM_PRIVATE_H
+#define CANSIM_PRIVATE_H
+
+/**
+ * @brief Bits of a data frame with an 11-bit identifier, worst-case bit stuffing included.
+ */
+#define CANSIM_FRAME_BITS(Dlc)     (47U + (8U * (uint32_t)(Dlc)) + ((34U + (8U * (uint32_t)(Dlc)) - 1U) / 4U))
+
+#define CANSIM_MAX_FRAME_BITS      CANSIM_FRAME_BITS(8U)
+
+#endif /*CANSIM_PRIVATE_H*/
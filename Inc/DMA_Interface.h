@@ -0,0 +1,149 @@
+/**
+ * @file DMA_Interface.h
+ * @brief Interface for the DMA1/DMA2 stream driver.
+ *
+ * This file provides the stream level services shared by the peripheral drivers
+ * that move data by DMA (SDIO, SAI, USART). A stream is configured once, then
+ * re-armed with a new memory address and length for every transfer.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef DMA_INTERFACE_H
+#define DMA_INTERFACE_H
+
+#include <stdint.h>
+#include "../../../LIB/STM32F446xx.h"
+
+/**
+ * @name DMA stream flags
+ * @brief Flags returned by DMA_GetFlags() and accepted by DMA_ClearFlags(),
+ *        normalised to the layout of stream 0 whatever the stream number.
+ * @{
+ */
+#define DMA_FLAG_FE      0x01U   /**< FIFO error */
+#define DMA_FLAG_DME     0x04U   /**< Direct mode error */
+#define DMA_FLAG_TE      0x08U   /**< Transfer error */
+#define DMA_FLAG_HT      0x10U   /**< Half transfer */
+#define DMA_FLAG_TC      0x20U   /**< Transfer complete */
+#define DMA_FLAG_ALL     0x3DU   /**< Every flag of the stream */
+/** @} */
+
+/**
+ * @name DMA stream interrupt enables
+ * @brief Values OR-ed into DMA_StreamConfig_t::Interrupts.
+ * @{
+ */
+#define DMA_IT_DME       0x02U   /**< Direct mode error interrupt (CR.DMEIE) */
+#define DMA_IT_TE        0x04U   /**< Transfer error interrupt (CR.TEIE) */
+#define DMA_IT_HT        0x08U   /**< Half transfer interrupt (CR.HTIE) */
+#define DMA_IT_TC        0x10U   /**< Transfer complete interrupt (CR.TCIE) */
+#define DMA_IT_FE        0x80U   /**< FIFO error interrupt (FCR.FEIE) */
+/** @} */
+
+/**
+ * @enum DMA_Direction_t
+ * @brief Transfer direction of a stream.
+ */
+typedef enum
+{
+    DMA_PERIPH_TO_MEM = 0U,      /**< Peripheral to memory */
+    DMA_MEM_TO_PERIPH = 1U,      /**< Memory to peripheral */
+    DMA_MEM_TO_MEM    = 2U       /**< Memory to memory (DMA2 only) */
+} DMA_Direction_t;
+
+/**
+ * @enum DMA_DataSize_t
+ * @brief Size of one data item on the peripheral or memory side.
+ */
+typedef enum
+{
+    DMA_SIZE_BYTE     = 0U,      /**< 8-bit items */
+    DMA_SIZE_HALFWORD = 1U,      /**< 16-bit items */
+    DMA_SIZE_WORD     = 2U       /**< 32-bit items */
+} DMA_DataSize_t;
+
+/**
+ * @enum DMA_Burst_t
+ * @brief Burst length on the peripheral or memory port (FIFO mode only).
+ */
+typedef enum
+{
+    DMA_BURST_SINGLE = 0U,       /**< Single transfer */
+    DMA_BURST_INC4   = 1U,       /**< Incremental burst of 4 beats */
+    DMA_BURST_INC8   = 2U,       /**< Incremental burst of 8 beats */
+    DMA_BURST_INC16  = 3U        /**< Incremental burst of 16 beats */
+} DMA_Burst_t;
+
+/**
+ * @struct DMA_StreamConfig_t
+ * @brief Static configuration of a DMA stream.
+ */
+typedef struct
+{
+    uint8_t         Channel;          /**< Request channel 0-7 routed to the stream */
+    DMA_Direction_t Direction;        /**< Transfer direction */
+    DMA_DataSize_t  PeriphSize;       /**< Peripheral item size */
+    DMA_DataSize_t  MemSize;          /**< Memory item size */
+    DMA_Burst_t     PeriphBurst;      /**< Peripheral burst, ignored in direct mode */
+    DMA_Burst_t     MemBurst;         /**< Memory burst, ignored in direct mode */
+    uint8_t         Priority;         /**< Software priority 0 (low) to 3 (very high) */
+    uint8_t         MemIncrement;     /**< 1 to increment the memory address after each item */
+    uint8_t         Circular;         /**< 1 for circular mode */
+    uint8_t         PeriphFlowControl;/**< 1 when the peripheral ends the transfer (SDIO) */
+    uint8_t         FifoEnable;       /**< 1 to use the FIFO with a full threshold, 0 for direct mode */
+    uint8_t         Interrupts;       /**< Combination of DMA_IT_x values */
+    uint32_t        PeriphAddress;    /**< Address of the peripheral data register */
+} DMA_StreamConfig_t;
+
+/**
+ * @brief Configures a DMA stream, leaving it disabled.
+ *
+ * Disables the stream, waits until the hardware releases it, clears its flags and
+ * programs the peripheral address, FIFO and control registers.
+ *
+ * @param[in] DMAx    DMA controller, DMA_1 or DMA_2.
+ * @param[in] Stream  Stream number 0-7.
+ * @param[in] Config  Stream configuration.
+ * @return uint8_t OK on success, NULL_PTR_ERR or NOK on invalid arguments.
+ */
+uint8_t DMA_StreamInit(DMA_RegDef_t* DMAx, uint8_t Stream, const DMA_StreamConfig_t* Config);
+
+/**
+ * @brief Arms and enables a configured stream for one transfer.
+ *
+ * @param[in] DMAx        DMA controller, DMA_1 or DMA_2.
+ * @param[in] Stream      Stream number 0-7.
+ * @param[in] MemAddress  Memory buffer address.
+ * @param[in] Count       Number of peripheral sized items (ignored under peripheral flow control).
+ */
+void DMA_StreamStart(DMA_RegDef_t* DMAx, uint8_t Stream, uint32_t MemAddress, uint16_t Count);
+
+/**
+ * @brief Disables a stream and waits until the hardware has stopped it.
+ *
+ * @param[in] DMAx    DMA controller, DMA_1 or DMA_2.
+ * @param[in] Stream  Stream number 0-7.
+ */
+void DMA_StreamStop(DMA_RegDef_t* DMAx, uint8_t Stream);
+
+/**
+ * @brief Reads the status flags of a stream.
+ *
+ * @param[in] DMAx    DMA controller, DMA_1 or DMA_2.
+ * @param[in] Stream  Stream number 0-7.
+ * @return uint32_t Combination of DMA_FLAG_x values.
+ */
+uint32_t DMA_GetFlags(DMA_RegDef_t* DMAx, uint8_t Stream);
+
+/**
+ * @brief Clears status flags of a stream.
+ *
+ * @param[in] DMAx    DMA controller, DMA_1 or DMA_2.
+ * @param[in] Stream  Stream number 0-7.
+ * @param[in] Flags   Combination of DMA_FLAG_x values to clear.
+ */
+void DMA_ClearFlags(DMA_RegDef_t* DMAx, uint8_t Stream, uint32_t Flags);
+
+#endif /* DMA_INTERFACE_H */
@@ -0,0 +1,29 @@
+#ifndef DMA_PRIVATE_H
+#define DMA_PRIVATE_H
+
+#define DMA_STREAM_COUNT        8U        /**< Streams per DMA controller */
+
+/* Stream x configuration register (DMA_SxCR) bit positions */
+#define DMA_SXCR_EN             0U        /**< Stream enable */
+#define DMA_SXCR_DMEIE          1U        /**< Direct mode error interrupt enable */
+#define DMA_SXCR_PFCTRL         5U        /**< Peripheral flow controller */
+#define DMA_SXCR_DIR            6U        /**< Data transfer direction, 2 bits */
+#define DMA_SXCR_CIRC           8U        /**< Circular mode */
+#define DMA_SXCR_MINC           10U       /**< Memory increment mode */
+#define DMA_SXCR_PSIZE          11U       /**< Peripheral data size, 2 bits */
+#define DMA_SXCR_MSIZE          13U       /**< Memory data size, 2 bits */
+#define DMA_SXCR_PL             16U       /**< Priority level, 2 bits */
+#define DMA_SXCR_PBURST         21U       /**< Peripheral burst, 2 bits */
+#define DMA_SXCR_MBURST         23U       /**< Memory burst, 2 bits */
+#define DMA_SXCR_CHSEL          25U       /**< Channel selection, 3 bits */
+
+#define DMA_SXCR_IT_MASK        0x1EU     /**< DMEIE, TEIE, HTIE and TCIE bits */
+
+/* Stream x FIFO control register (DMA_SxFCR) bit positions */
+#define DMA_SXFCR_FTH           0U        /**< FIFO threshold, 2 bits */
+#define DMA_SXFCR_DMDIS         2U        /**< Direct mode disable */
+#define DMA_SXFCR_FEIE          7U        /**< FIFO error interrupt enable */
+
+#define DMA_SXFCR_FTH_FULL      3U        /**< Full FIFO threshold */
+
+#endif /*DMA_PRIVATE_H*/
@@ -0,0 +1,134 @@
+/**
+ * @file DSPK_Interface.h
+ * @brief Interface for the Q15 signal processing kernels run from block interrupts.
+ *
+ * This file provides block FIR, biquad cascade and decimating FIR kernels on Q15 samples,
+ * and a saturating block add. On a core with the DSP extension (__ARM_FEATURE_DSP, the
+ * Cortex-M4) they multiply two 16-bit samples per instruction (SMLALD, QADD16); elsewhere
+ * they run the portable reference versions, which are always built under the _Ref names.
+ * Both give bit-identical results: products are summed exactly in 64 bits, then shifted
+ * and saturated to Q15.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef DSPK_INTERFACE_H
+#define DSPK_INTERFACE_H
+
+#include <stdint.h>
+
+#define DSPK_FIR_STATE_SIZE(Taps, BlockMax)   ((uint32_t)(Taps) + (uint32_t)(BlockMax) - 1U)   /**< int16_t elements */
+#define DSPK_BIQUAD_STATE_SIZE(Stages)        (4U * (uint32_t)(Stages))                      /**< int16_t elements */
+
+/**
+ * @struct DSPK_FirQ15_t
+ * @brief FIR filter instance.
+ */
+typedef struct
+{
+    const int16_t* Coeffs;   /**< Taps coefficients in time-reversed order: Coeffs[Taps - 1] weights the newest sample */
+    int16_t* State;          /**< DSPK_FIR_STATE_SIZE(Taps, BlockMax) samples */
+    uint16_t Taps;
+    uint16_t BlockMax;       /**< Largest block accepted */
+} DSPK_FirQ15_t;
+
+/**
+ * @struct DSPK_BiquadQ15_t
+ * @brief Cascade of direct form I biquad sections.
+ *
+ * Each stage has 5 coefficients { b0, b1, b2, a1, a2 } in Q(15 - PostShift), the a terms
+ * negated: y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2].
+ * PostShift gives headroom for coefficients of magnitude 1 or more.
+ */
+typedef struct
+{
+    const int16_t* Coeffs;   /**< 5 * Stages coefficients */
+    int16_t* State;          /**< DSPK_BIQUAD_STATE_SIZE(Stages) samples: x[n-1], x[n-2], y[n-1], y[n-2] per stage */
+    uint8_t Stages;
+    uint8_t PostShift;       /**< 0 to 2 */
+} DSPK_BiquadQ15_t;
+
+/**
+ * @struct DSPK_DecimQ15_t
+ * @brief Decimating FIR instance: filters, then keeps one output in Factor.
+ */
+typedef struct
+{
+    DSPK_FirQ15_t Fir;
+    uint8_t Factor;
+} DSPK_DecimQ15_t;
+
+/**
+ * @brief Sets up a FIR filter and clears its history.
+ *
+ * @param[out] Fir       Instance to set up.
+ * @param[in]  Coeffs    Taps coefficients, time-reversed.
+ * @param[in]  Taps      Number of taps, at least 1.
+ * @param[in]  State     Buffer of DSPK_FIR_STATE_SIZE(Taps, BlockMax) samples.
+ * @param[in]  BlockMax  Largest block passed to DSPK_FirQ15().
+ * @return uint8_t OK, NOK on a zero size, NULL_PTR_ERR on a NULL pointer.
+ */
+uint8_t DSPK_FirQ15Init(DSPK_FirQ15_t* Fir, const int16_t* Coeffs, uint16_t Taps, int16_t* State, uint16_t BlockMax);
+
+/**
+ * @brief Filters a block of samples.
+ *
+ * @param[in,out] Fir    FIR instance.
+ * @param[in]     In     Count input samples.
+ * @param[out]    Out    Count output samples; may be In.
+ * @param[in]     Count  Block size, at most BlockMax.
+ */
+void DSPK_FirQ15(DSPK_FirQ15_t* Fir, const int16_t* In, int16_t* Out, uint32_t Count);
+void DSPK_FirQ15Ref(DSPK_FirQ15_t* Fir, const int16_t* In, int16_t* Out, uint32_t Count);
+
+/**
+ * @brief Sets up a biquad cascade and clears its history.
+ *
+ * @return uint8_t OK, NOK on zero stages or PostShift above 2, NULL_PTR_ERR on a NULL pointer.
+ */
+uint8_t DSPK_BiquadQ15Init(DSPK_BiquadQ15_t* Biquad, const int16_t* Coeffs, uint8_t Stages, int16_t* State, uint8_t PostShift);
+
+/**
+ * @brief Runs a block of samples through the cascade.
+ *
+ * @param[in,out] Biquad  Biquad instance.
+ * @param[in]     In      Count input samples.
+ * @param[out]    Out     Count output samples; may be In.
+ * @param[in]     Count   Block size.
+ */
+void DSPK_BiquadQ15(DSPK_BiquadQ15_t* Biquad, const int16_t* In, int16_t* Out, uint32_t Count);
+void DSPK_BiquadQ15Ref(DSPK_BiquadQ15_t* Biquad, const int16_t* In, int16_t* Out, uint32_t Count);
+
+/**
+ * @brief Sets up a decimating FIR and clears its history.
+ *
+ * @param[in] BlockMax  Largest input block, a multiple of Factor.
+ * @return uint8_t OK, NOK on a zero size or a BlockMax not a multiple of Factor, NULL_PTR_ERR on a NULL pointer.
+ */
+uint8_t DSPK_DecimQ15Init(DSPK_DecimQ15_t* Decim, const int16_t* Coeffs, uint16_t Taps, int16_t* State, uint16_t BlockMax,
+                          uint8_t Factor);
+
+/**
+ * @brief Filters and decimates a block: only the kept outputs are computed.
+ *
+ * @param[in,out] Decim  Decimator instance.
+ * @param[in]     In     Count input samples.
+ * @param[out]    Out    Count / Factor output samples, the filter output at the last input of each group.
+ * @param[in]     Count  Block size, a multiple of Factor, at most BlockMax.
+ */
+void DSPK_DecimQ15(DSPK_DecimQ15_t* Decim, const int16_t* In, int16_t* Out, uint32_t Count);
+void DSPK_DecimQ15Ref(DSPK_DecimQ15_t* Decim, const int16_t* In, int16_t* Out, uint32_t Count);
+
+/**
+ * @brief Adds two blocks with Q15 saturation, for mixing channels.
+ *
+ * @param[in]  A      Count samples.
+ * @param[in]  B      Count samples.
+ * @param[out] Out    Count samples; may be A or B.
+ * @param[in]  Count  Block size.
+ */
+void DSPK_AddQ15(const int16_t* A, const int16_t* B, int16_t* Out, uint32_t Count);
+void DSPK_AddQ15Ref(const int16_t* A, const int16_t* B, int16_t* Out, uint32_t Count);
+
+#endif /* DSPK_INTERFACE_H */
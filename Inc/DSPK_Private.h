@@ -0,0 +1,19 @@
+#ifndef DSPK_PRIVATE_H
+#define DSPK_PRIVATE_H
+
+#if !defined(DSPK_SIMD)                 /**< May be forced to 1 by a host test that emulates the intrinsics */
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define DSPK_SIMD                1   /**< Dual 16-bit multiply-accumulate available */
+#else
+#define DSPK_SIMD                0
+#endif
+#endif
+
+#define DSPK_Q15_SHIFT           15U
+#define DSPK_BIQUAD_COEFFS       5U    /**< b0, b1, b2, a1, a2 */
+#define DSPK_BIQUAD_STATES       4U    /**< x[n-1], x[n-2], y[n-1], y[n-2] */
+#define DSPK_MAX_POSTSHIFT       2U
+
+#define DSPK_PACK(Low, High)     ((uint32_t)(uint16_t)(Low) | ((uint32_t)(uint16_t)(High) << 16))
+
+#endif /*DSPK_PRIVATE_H*/
@@ -0,0 +1,100 @@
+/**
+ * @file EVBUS_Interface.h
+ * @brief Interface for the interrupt-level publish/subscribe event bus.
+ *
+ * This file provides a bus of up to 32 topics and 32 subscribers. Each subscriber runs at
+ * an NVIC priority level, in the dispatch IRQ of that level, and each topic has a static
+ * bitmap of its subscribers. Publishing sets the topic's bit in the pending bitmap of
+ * every level it has subscribers at, and pends a level's dispatch IRQ only when its
+ * bitmap goes from empty to non-empty. A publish therefore costs one atomic OR per level,
+ * however many subscribers the topic has, and a burst of publishes raises each level once.
+ *
+ * Topics carry no payload: a pending topic tells its subscribers to read the shared data
+ * (for instance through a SEQLOCK latch). Publishing a topic that is already pending at a
+ * level is merged into the pending delivery.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef EVBUS_INTERFACE_H
+#define EVBUS_INTERFACE_H
+
+#include <stdint.h>
+#include "NVIC_Interface.h"
+
+#define EVBUS_MAX_TOPICS         32U
+#define EVBUS_MAX_SUBSCRIBERS    32U
+#define EVBUS_LEVELS             16U
+#define EVBUS_NO_IRQ             0xFFU   /**< Level without a dispatch IRQ */
+
+/**
+ * @brief Subscriber callback, run in the dispatch IRQ of the subscriber's level.
+ */
+typedef void (*EVBUS_Handler_t)(uint8_t Topic, void* Context);
+
+/**
+ * @struct EVBUS_Subscriber_t
+ * @brief One subscriber.
+ */
+typedef struct
+{
+    EVBUS_Handler_t Handler;
+    void* Context;
+    uint8_t Level;           /**< NVIC priority its handler runs at, 0-15 */
+} EVBUS_Subscriber_t;
+
+/**
+ * @struct EVBUS_Config_t
+ * @brief Static description of the bus.
+ */
+typedef struct
+{
+    const EVBUS_Subscriber_t* Subscribers;
+    const uint32_t* Topics;              /**< Per topic, bit n set when subscriber n receives it */
+    uint8_t SubscriberCount;
+    uint8_t TopicCount;
+    uint8_t LevelIrq[EVBUS_LEVELS];      /**< Dispatch IRQ per level, EVBUS_NO_IRQ when unused */
+} EVBUS_Config_t;
+
+/**
+ * @brief Checks the configuration and sets up the dispatch IRQs.
+ *
+ * Each dispatch IRQ used gets its level as priority and is enabled. The IRQs must have no
+ * peripheral in use and their vectors must call EVBUS_Dispatch().
+ * The whole configuration is checked first: when it is rejected, no state, priority or
+ * enable bit has been changed.
+ *
+ * @param[in] Config  Bus description, kept by pointer.
+ * @return uint8_t OK, NOK when a subscriber's level has no dispatch IRQ, a dispatch IRQ is
+ *                 invalid or given to two levels, or a count is over its maximum,
+ *                 NULL_PTR_ERR on a NULL pointer.
+ */
+uint8_t EVBUS_Init(const EVBUS_Config_t* Config);
+
+/**
+ * @brief Publishes a topic; callable from any priority, lock-free.
+ *
+ * @param[in] Topic  Topic index.
+ * @return uint8_t OK, NOK on an invalid topic.
+ */
+uint8_t EVBUS_Publish(uint8_t Topic);
+
+/**
+ * @brief Dispatch IRQ handler: delivers the topics pending at the level the running IRQ
+ *        was given in LevelIrq, even if its priority has been changed since EVBUS_Init().
+ */
+void EVBUS_Dispatch(void);
+
+/**
+ * @brief Delivers the topics pending at a level.
+ *
+ * Topics are delivered highest index first. The level's bitmap is emptied before the
+ * delivery, so a topic published again during it pends the IRQ again and is delivered
+ * in the next run.
+ *
+ * @param[in] Level  Priority level, 0-15.
+ */
+void EVBUS_DispatchLevel(uint8_t Level);
+
+#endif /* EVBUS_INTERFACE_H */
@@ -0,0 +1,7 @@
+#ifndef EVBUS_PRIVATE_H
+#define EVBUS_PRIVATE_H
+
+#define EVBUS_EXCEPTION_OFFSET    16U   /**< IPSR exception number of IRQ 0 */
+#define EVBUS_NO_LEVEL            0xFFU /**< EVBUS_IrqLevel entry of an IRQ that dispatches no level */
+
+#endif /*EVBUS_PRIVATE_H*/
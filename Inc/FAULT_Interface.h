@@ -0,0 +1,99 @@
+/**
+ * @file FAULT_Interface.h
+ * @brief Interface for the fault handlers that capture a crash record with NVIC state.
+ *
+ * This file provides the crash record layout and the function declarations required to
+ * install the fault capture and to read the record back after the reset. The record
+ * holds the stacked exception frame, the fault status registers and the NVIC active,
+ * pending and BASEPRI state, so a fault inside nested handlers can be attributed to the
+ * interrupt that was running. Tools/FaultDecode.c decodes a raw record on the host.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef FAULT_INTERFACE_H
+#define FAULT_INTERFACE_H
+
+#include <stdint.h>
+#include "NVIC_Interface.h"
+
+#define FAULT_RECORD_MAGIC      0x464C5421UL   /**< "FLT!" */
+
+/**
+ * @enum FAULT_FrameIndex_t
+ * @brief Position of the registers in the stacked exception frame.
+ */
+typedef enum
+{
+    FAULT_FRAME_R0 = 0U,
+    FAULT_FRAME_R1,
+    FAULT_FRAME_R2,
+    FAULT_FRAME_R3,
+    FAULT_FRAME_R12,
+    FAULT_FRAME_LR,
+    FAULT_FRAME_PC,
+    FAULT_FRAME_XPSR,
+    FAULT_FRAME_WORDS
+} FAULT_FrameIndex_t;
+
+/**
+ * @struct FAULT_Record_t
+ * @brief Crash record kept across the reset; every field is a 32-bit little-endian word.
+ */
+typedef struct
+{
+    uint32_t Magic;                       /**< FAULT_RECORD_MAGIC when the record is complete */
+    uint32_t Exception;                   /**< IPSR of the fault handler: 3 HardFault, 4 MemManage, 5 BusFault, 6 UsageFault */
+    uint32_t ExcReturn;                   /**< EXC_RETURN of the fault: bit 2 selects PSP, bit 3 thread mode */
+    uint32_t StackPointer;                /**< Address of the stacked frame */
+    uint32_t FrameValid;                  /**< 1 when Frame was read, 0 when the stack pointer was unusable */
+    uint32_t Frame[FAULT_FRAME_WORDS];    /**< R0-R3, R12, LR, PC and xPSR of the faulting context */
+    uint32_t Cfsr;                        /**< SCB CFSR */
+    uint32_t Hfsr;                        /**< SCB HFSR */
+    uint32_t Mmfar;                       /**< SCB MMFAR */
+    uint32_t Bfar;                        /**< SCB BFAR */
+    uint32_t Shcsr;                       /**< SCB SHCSR, shows the system handlers that were active */
+    uint32_t BasePri;                     /**< BASEPRI of the faulting context */
+    uint32_t Active[NVIC_IRQ_WORDS];      /**< NVIC IABR: interrupts on the stack when the fault hit */
+    uint32_t Pending[NVIC_IRQ_WORDS];     /**< NVIC ISPR */
+    uint32_t Checksum;                    /**< Sum of every word above plus Magic */
+} FAULT_Record_t;
+
+/**
+ * @brief Enables the MemManage, BusFault and UsageFault handlers.
+ *
+ * Without this every fault escalates to HardFault; the record then still tells the
+ * original cause through CFSR.
+ */
+void FAULT_Init(void);
+
+/**
+ * @brief Retrieves the crash record of the previous run.
+ *
+ * @param[out] Record  Copy of the record.
+ * @return uint8_t OK when an intact record exists, NOK otherwise, NULL_PTR_ERR on a NULL argument.
+ */
+uint8_t FAULT_GetRecord(FAULT_Record_t* Record);
+
+/**
+ * @brief Invalidates the crash record.
+ */
+void FAULT_ClearRecord(void);
+
+/**
+ * @brief Fault capture, entered from the fault handlers with the stacked frame address.
+ *
+ * Saves the record, then halts under a debugger or requests a system reset.
+ *
+ * @param[in] Frame      Stacked exception frame (MSP or PSP at fault entry).
+ * @param[in] ExcReturn  EXC_RETURN value of the fault handler.
+ */
+void FAULT_Capture(uint32_t* Frame, uint32_t ExcReturn);
+
+void HardFault_Handler(void);
+void MemManage_Handler(void);
+void BusFault_Handler(void);
+void UsageFault_Handler(void);
+
+#endif /* FAULT_INTERFACE_H */
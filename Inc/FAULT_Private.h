@@ -0,0 +1,27 @@
+#ifndef FAULT_PRIVATE_H
+#define FAULT_PRIVATE_H
+
+#define FAULT_RETAINED            __attribute__((section(".noinit")))   /**< RAM left untouched by the startup code */
+
+/* SHCSR fault handler enables */
+#define FAULT_SHCSR_MEMFAULTENA   16U
+#define FAULT_SHCSR_BUSFAULTENA   17U
+#define FAULT_SHCSR_USGFAULTENA   18U
+
+/* DHCSR debugger connected bit */
+#define FAULT_DHCSR_C_DEBUGEN     0U
+
+/**
+ * @brief Body of the fault handlers: picks the stack that holds the frame from bit 2
+ *        of EXC_RETURN and tail-calls FAULT_Capture(Frame, ExcReturn).
+ */
+#define FAULT_HANDLER_BODY()                \
+    __asm volatile (                        \
+        "TST   lr, #4          \n"          \
+        "ITE   EQ              \n"          \
+        "MRSEQ r0, msp         \n"          \
+        "MRSNE r0, psp         \n"          \
+        "MOV   r1, lr          \n"          \
+        "B     FAULT_Capture   \n")
+
+#endif /*FAULT_PRIVATE_H*/
@@ -0,0 +1,149 @@
+/**
+ * @file HSM_Interface.h
+ * @brief Interface for the table-driven hierarchical state machines.
+ *
+ * This file provides a hierarchical state machine engine whose transitions are resolved
+ * once, at HSM_Init(): for every state and event the table holds the transition taken
+ * (inherited from the nearest ancestor that handles the event) and the least common
+ * ancestor of its source and target. Dispatching an event is then one table lookup, the
+ * exits up to that ancestor, the action and the entries down to the target: a cost fixed
+ * by the state depth, with no search.
+ *
+ * Transitions are external: the source is exited and re-entered on a self-transition or
+ * a transition to a substate. A transition with no target is internal: only its action
+ * runs. Entering a state with an initial substate descends into it.
+ *
+ * Each machine is bound to an IRQ whose priority sets the level its events run at.
+ * HSM_Post() queues an event and pends the IRQ; the IRQ runs the queued events to
+ * completion, one after the other.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef HSM_INTERFACE_H
+#define HSM_INTERFACE_H
+
+#include <stdint.h>
+#include "NVIC_Interface.h"
+
+#define HSM_NONE         0xFFU   /**< No state: top of the hierarchy, or no target */
+#define HSM_MAX_DEPTH    8U      /**< Deepest state nesting */
+
+/**
+ * @brief Entry, exit or transition action, called with the machine's context.
+ */
+typedef void (*HSM_Action_t)(void* Context);
+
+/**
+ * @struct HSM_StateDef_t
+ * @brief Definition of one state.
+ */
+typedef struct
+{
+    uint8_t Parent;          /**< Enclosing state, HSM_NONE at the top */
+    uint8_t Initial;         /**< Substate entered after this one, HSM_NONE for a leaf */
+    HSM_Action_t Entry;      /**< May be NULL */
+    HSM_Action_t Exit;       /**< May be NULL */
+} HSM_StateDef_t;
+
+/**
+ * @struct HSM_TransitionDef_t
+ * @brief Definition of one transition; the first one listed wins for a state and event.
+ */
+typedef struct
+{
+    uint8_t Source;
+    uint8_t Event;
+    uint8_t Target;          /**< HSM_NONE for an internal transition */
+    HSM_Action_t Action;     /**< May be NULL */
+} HSM_TransitionDef_t;
+
+/**
+ * @struct HSM_Definition_t
+ * @brief Constant description of a machine, shareable between instances.
+ */
+typedef struct
+{
+    const HSM_StateDef_t* States;
+    const HSM_TransitionDef_t* Transitions;
+    uint8_t StateCount;      /**< At most 255 */
+    uint8_t TransitionCount; /**< At most 255 */
+    uint8_t EventCount;
+    uint8_t Initial;         /**< State entered by HSM_Init() */
+} HSM_Definition_t;
+
+/**
+ * @struct HSM_Cell_t
+ * @brief Resolved transition of one state and event.
+ */
+typedef struct
+{
+    uint8_t Transition;      /**< Index in the definition, HSM_NONE when the event is ignored */
+    uint8_t Lca;             /**< Deepest proper ancestor of source and target, HSM_NONE for the top */
+} HSM_Cell_t;
+
+/**
+ * @struct HSM_Machine_t
+ * @brief One running machine.
+ */
+typedef struct
+{
+    const HSM_Definition_t* Definition;
+    HSM_Cell_t* Table;          /**< StateCount * EventCount cells, filled by HSM_Init() */
+    uint8_t* Queue;             /**< Event queue storage */
+    uint16_t QueueMask;         /**< Queue size - 1 */
+    volatile uint16_t Head;     /**< Next slot written by HSM_Post() */
+    volatile uint16_t Tail;     /**< Next event run */
+    uint32_t Dropped;           /**< Events lost to a full queue */
+    void* Context;
+    uint8_t Current;            /**< Active leaf state */
+    uint8_t Bound;              /**< Set by HSM_Bind() */
+    IRQn_Type IRQn;
+} HSM_Machine_t;
+
+/**
+ * @brief Resolves the transition table and enters the initial state.
+ *
+ * @param[out] Machine    Machine to set up.
+ * @param[in]  Definition States and transitions.
+ * @param[in]  Table      StateCount * EventCount cells.
+ * @param[in]  Queue      Event queue storage.
+ * @param[in]  QueueSize  Queue size, a power of two.
+ * @param[in]  Context    Passed to every action.
+ * @return uint8_t OK, NOK on an invalid definition (bad index, cycle, nesting over
+ *                 HSM_MAX_DEPTH) or queue size, NULL_PTR_ERR on a NULL pointer.
+ */
+uint8_t HSM_Init(HSM_Machine_t* Machine, const HSM_Definition_t* Definition, HSM_Cell_t* Table, uint8_t* Queue,
+                 uint16_t QueueSize, void* Context);
+
+/**
+ * @brief Binds the machine to an IRQ with no peripheral in use, at the given priority.
+ *
+ * The IRQ's vector must call HSM_Dispatch() with the machine, directly or through
+ * IRQHT_Dispatch().
+ */
+void HSM_Bind(HSM_Machine_t* Machine, IRQn_Type IRQn, uint32_t Priority);
+
+/**
+ * @brief Queues an event and pends the machine's IRQ; callable from any priority.
+ *
+ * @return uint8_t OK, NOK when the event is invalid or the queue is full.
+ */
+uint8_t HSM_Post(HSM_Machine_t* Machine, uint8_t Event);
+
+/**
+ * @brief Runs every queued event to completion; call it from the bound IRQ.
+ *
+ * @param[in] Machine  HSM_Machine_t* of the machine, untyped to match IRQHT_Handler_t.
+ */
+void HSM_Dispatch(void* Machine);
+
+/**
+ * @brief Runs one event to completion right away, bypassing the queue.
+ *
+ * Call it only at the machine's own level.
+ */
+void HSM_Handle(HSM_Machine_t* Machine, uint8_t Event);
+
+#endif /* HSM_INTERFACE_H */
@@ -0,0 +1,6 @@
+#ifndef HSM_PRIVATE_H
+#define HSM_PRIVATE_H
+
+#define HSM_CELL(Machine, State, Event)    ((Machine)->Table[((uint32_t)(State) * (Machine)->Definition->EventCount) + (Event)])
+
+#endif /*HSM_PRIVATE_H*/
@@ -0,0 +1,93 @@
+/**
+ * @file IDLE_Interface.h
+ * @brief Interface for the background job scheduler run from the idle loop.
+ *
+ * This file provides background jobs (flash wear leveling, statistics compaction, ...)
+ * run in thread mode one bounded step at a time, only when no exception is pending.
+ * A job is made ready by IDLE_Request() from any context; each step does a slice of its
+ * work, keeps its own position in its context and returns IDLE_STEP_MORE until the job
+ * is done. Ready jobs take turns, one step each. With no job ready the core sleeps in
+ * WFI.
+ *
+ * Interrupts preempt a step as any thread code, so the budget matters for what cannot be
+ * preempted: sections run with interrupts masked and flash program/erase stalls. A step
+ * polls IDLE_ShouldYield() between such units of work, outside any BASEPRI section, and
+ * returns when it says so.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef IDLE_INTERFACE_H
+#define IDLE_INTERFACE_H
+
+#include <stdint.h>
+
+#define IDLE_MAX_JOBS    32U
+
+/**
+ * @enum IDLE_StepResult_t
+ * @brief What a step reports to the scheduler.
+ */
+typedef enum
+{
+    IDLE_STEP_DONE = 0,   /**< Job finished until its next IDLE_Request() */
+    IDLE_STEP_MORE        /**< Job has work left; run another step later */
+} IDLE_StepResult_t;
+
+/**
+ * @brief Runs one step of a job.
+ */
+typedef IDLE_StepResult_t (*IDLE_Step_t)(void* Context);
+
+/**
+ * @struct IDLE_Job_t
+ * @brief One background job; Step, Context and BudgetCycles are set by the caller.
+ */
+typedef struct
+{
+    IDLE_Step_t Step;
+    void* Context;
+    uint32_t BudgetCycles;   /**< CPU cycles a step may take */
+    uint32_t MaxCycles;      /**< Longest step seen, statistic */
+    uint32_t Overruns;       /**< Steps over budget, statistic */
+    uint8_t Index;           /**< Set by IDLE_Register() */
+} IDLE_Job_t;
+
+/**
+ * @brief Registers a job, not ready; starts the DWT cycle counter.
+ *
+ * @param[in,out] Job  Job to register, kept by pointer.
+ * @return uint8_t OK, NOK when IDLE_MAX_JOBS jobs are registered or BudgetCycles is zero,
+ *                 NULL_PTR_ERR on a NULL pointer.
+ */
+uint8_t IDLE_Register(IDLE_Job_t* Job);
+
+/**
+ * @brief Makes a job ready; callable from any priority, lock-free.
+ *
+ * @param[in] Job  Registered job.
+ */
+void IDLE_Request(const IDLE_Job_t* Job);
+
+/**
+ * @brief Runs one step of the next ready job, or sleeps; call from the idle loop.
+ *
+ * With PRIMASK set it checks for a pending exception and for ready jobs, then either
+ * returns to let the exception be taken, runs a step with interrupts unmasked, or
+ * executes WFI: an interrupt arriving after the check still wakes the core. Must be
+ * called from thread mode with PRIMASK clear.
+ */
+void IDLE_Poll(void);
+
+/**
+ * @brief Called inside a step: reports whether the step should return now.
+ *
+ * Pending exceptions are read from VECTPENDING, which does not report IRQs masked by
+ * BASEPRI: call it with BASEPRI cleared. Under PRIMASK alone they are still reported.
+ *
+ * @return uint8_t 1 when the step's budget is spent or an exception is pending, 0 otherwise.
+ */
+uint8_t IDLE_ShouldYield(void);
+
+#endif /* IDLE_INTERFACE_H */
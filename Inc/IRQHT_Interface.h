@@ -0,0 +1,78 @@
+/**
+ * @file IRQHT_Interface.h
+ * @brief Interface for the runtime interrupt handler table.
+ *
+ * This file provides a RAM table binding each IRQ to a handler and its context. The
+ * binding of an IRQ can be replaced while the IRQ stays enabled: the new binding is
+ * published with a single pointer store, and the old one is handed back only once no
+ * running instance of the handler can still be using it (its grace period, read from
+ * IABR). A binding whose grace period has not ended is retired and reclaimed later.
+ *
+ * Install IRQHT_Dispatch() in the vector table slot of every IRQ managed here. Each IRQ
+ * must have a single writer: replacements of the same IRQ must not preempt each other.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef IRQHT_INTERFACE_H
+#define IRQHT_INTERFACE_H
+
+#include <stdint.h>
+#include "NVIC_Interface.h"
+
+/**
+ * @brief Handler called with the context of its binding.
+ */
+typedef void (*IRQHT_Handler_t)(void* Context);
+
+/**
+ * @struct IRQHT_Binding_t
+ * @brief Handler and context of one IRQ, owned by the caller; must stay valid until handed back.
+ */
+typedef struct IRQHT_Binding
+{
+    IRQHT_Handler_t Handler;
+    void* Context;
+    struct IRQHT_Binding* Next;   /**< Retired list link, used by the table */
+} IRQHT_Binding_t;
+
+/**
+ * @brief Vector table entry of the managed IRQs: runs the handler bound to the current IRQ.
+ */
+void IRQHT_Dispatch(void);
+
+/**
+ * @brief Publishes a new binding for an IRQ, without masking it.
+ *
+ * Entries of the IRQ after the call run the new binding. The old binding is returned in
+ * Old when its grace period has already ended. Otherwise Old is set to NULL and the old
+ * binding is retired: an instance of the handler is active beneath the caller (the
+ * caller is that handler, or preempted it) and may still use it.
+ *
+ * @param[in]  IRQn  IRQ to rebind.
+ * @param[in]  New   New binding, or NULL to unbind (with the source quiet or the IRQ disabled).
+ * @param[out] Old   Binding that may be released now, or NULL.
+ * @return uint8_t OK on success, NOK on an invalid IRQ, NULL_PTR_ERR when Old is NULL.
+ */
+uint8_t IRQHT_Replace(IRQn_Type IRQn, IRQHT_Binding_t* New, IRQHT_Binding_t** Old);
+
+/**
+ * @brief Hands back a retired binding of an IRQ whose grace period has ended.
+ *
+ * Call it again, from the writer's context, until it returns NULL.
+ *
+ * @param[in] IRQn  IRQ whose retired bindings are reclaimed.
+ * @return IRQHT_Binding_t* A binding that may be released, or NULL.
+ */
+IRQHT_Binding_t* IRQHT_Reclaim(IRQn_Type IRQn);
+
+/**
+ * @brief Returns the binding currently published for an IRQ.
+ *
+ * @param[in] IRQn  IRQ to look up.
+ * @return IRQHT_Binding_t* The binding, or NULL when unbound.
+ */
+IRQHT_Binding_t* IRQHT_Get(IRQn_Type IRQn);
+
+#endif /* IRQHT_INTERFACE_H */
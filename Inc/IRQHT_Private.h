@@ -0,0 +1,6 @@
+#ifndef IRQHT_PRIVATE_H
+#define IRQHT_PRIVATE_H
+
+#define IRQHT_EXCEPTION_OFFSET    16U   /**< IPSR exception number of IRQ 0 */
+
+#endif /*IRQHT_PRIVATE_H*/
@@ -115,6 +115,10 @@ typedef enum {
 
 } IRQn_Type;
 
+#define NVIC_IRQ_COUNT      ((uint32_t)FMPI2C1_error + 1U)          /**< Number of vector table IRQ slots on the STM32F446xx */
+#define NVIC_IRQ_WORDS      ((NVIC_IRQ_COUNT + 31U) / 32U)          /**< ISER/ISPR/IABR words holding those slots */
+#define NVIC_NO_PENDING     (-16)                                   /**< NVIC_GetHighestPending(): no exception pending */
+
 
 
 /**
@@ -127,6 +131,28 @@ typedef enum {
  */
 void NVIC_EnableIRQ(IRQn_Type IRQn);
 
+/**
+ * @brief Clears a stale pending state of the specified IRQ, then enables it.
+ *
+ * Replaces the NVIC_ClearPendingIRQ() + NVIC_EnableIRQ() pair: the clear is completed
+ * before the enable, so a pend left over from before the enable is never taken. A pend
+ * raised after the clear is a real event and is taken as usual. Clear the peripheral's
+ * own flag first, or a level-triggered source pends again at once.
+ *
+ * @param[in] IRQn  IRQ number to enable of type IRQn_Type.
+ */
+void NVIC_EnableIRQClean(IRQn_Type IRQn);
+
+/**
+ * @brief Clears the stale pending state of a set of IRQs, then enables them.
+ *
+ * Bit n of Masks[w] selects IRQ 32 * w + n. Each ICPR and ISER word is written once,
+ * whatever the number of IRQs selected in it.
+ *
+ * @param[in] Masks  NVIC_IRQ_WORDS words of IRQ bits.
+ */
+void NVIC_EnableIRQMaskClean(const uint32_t Masks[NVIC_IRQ_WORDS]);
+
 /**
  * @brief Disables the specified IRQ interrupt.
  *
@@ -137,6 +163,24 @@ void NVIC_EnableIRQ(IRQn_Type IRQn);
  */
 void NVIC_DisableIRQ(IRQn_Type IRQn);
 
+/**
+ * @brief Disables the specified IRQ interrupt and returns once its handler cannot run.
+ *
+ * Unlike NVIC_DisableIRQ(), the disable has taken effect on return: the ICER write is
+ * completed and the pipeline flushed, so the handler is not entered after the call, and
+ * the handler is no longer active. Teardown code and handler swaps can then release the
+ * handler's data without masking every interrupt.
+ *
+ * A handler still active after the disable has been preempted by the caller, directly or
+ * through a chain of nested handlers, and cannot leave until the caller returns: that
+ * case is reported instead of waited on.
+ *
+ * @param[in] IRQn  IRQ number to disable of type IRQn_Type.
+ * @return uint8_t OK when the handler is quiescent, NOK when the caller is nested above it
+ *                 (the IRQ is disabled either way).
+ */
+uint8_t NVIC_DisableIRQSync(IRQn_Type IRQn);
+
 /**
  * @brief Sets the pending bit for the specified IRQ interrupt.
  *
@@ -196,4 +240,17 @@ uint32_t NVIC_GetPriority(IRQn_Type IRQn);
  */
 uint8_t NVIC_GetActive(IRQn_Type IRQn);
 
+/**
+ * @brief Reads the highest-priority pending exception from SCB ICSR (VECTPENDING).
+ *
+ * Exceptions held back by PRIMASK alone are reported, so code running with PRIMASK set
+ * can tell whether it delays one. VECTPENDING follows BASEPRI and FAULTMASK, though: an
+ * IRQ they mask is not reported. Code running under BASEPRI that must see those IRQs
+ * scans ISPR & ISER instead (NVIC_GetPendingIRQ()).
+ *
+ * @return int32_t IRQ number of the exception; negative for system exceptions (-1 SysTick,
+ *                 -2 PendSV, ...), NVIC_NO_PENDING when none is pending.
+ */
+int32_t NVIC_GetHighestPending(void);
+
 #endif /* NVIC_INTERFACE_H */
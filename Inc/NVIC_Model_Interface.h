@@ -0,0 +1,124 @@
+/**
+ * @file NVIC_Model_Interface.h
+ * @brief Interface for the software model of the NVIC registers used by host builds.
+ *
+ * This file provides a register model holding the enable, pending, active and priority
+ * state of every IRQ of IRQn_Type, with lock-free updates so that simulated peripherals
+ * running on other threads can pend interrupts. The POSIX port of NVIC_Interface.h and
+ * the host simulation harnesses build on it.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef NVIC_MODEL_INTERFACE_H
+#define NVIC_MODEL_INTERFACE_H
+
+#include <stdint.h>
+#include "NVIC_Interface.h"
+
+#define NVIC_MODEL_LEVELS      16U      /**< 4-bit priorities, as implemented on the STM32F446xx */
+#define NVIC_MODEL_NONE        (-1)     /**< No IRQ is deliverable */
+
+/**
+ * @struct NVIC_Model_t
+ * @brief NVIC register state: ISER, ISPR and IABR words plus one priority per IRQ.
+ */
+typedef struct
+{
+    volatile uint32_t Enabled[NVIC_IRQ_WORDS];   /**< ISER view, 1 = enabled */
+    volatile uint32_t Pending[NVIC_IRQ_WORDS];   /**< ISPR view, 1 = pending */
+    volatile uint32_t Active[NVIC_IRQ_WORDS];    /**< IABR view, 1 = handler running or preempted */
+    volatile uint8_t  Priority[NVIC_IRQ_COUNT];  /**< Priority 0 (highest) to 15 */
+} NVIC_Model_t;
+
+/**
+ * @brief Clears every enable, pending and active bit and every priority.
+ *
+ * @param[out] Model  Register model.
+ */
+void NVIC_Model_Reset(NVIC_Model_t* Model);
+
+/**
+ * @brief Sets or clears the enable bit of an IRQ.
+ *
+ * @param[in,out] Model   Register model.
+ * @param[in]     IRQn    Interrupt number.
+ * @param[in]     Enable  1 to enable, 0 to disable.
+ */
+void NVIC_Model_SetEnabled(NVIC_Model_t* Model, IRQn_Type IRQn, uint8_t Enable);
+
+/**
+ * @brief Sets or clears the pending bit of an IRQ.
+ *
+ * @param[in,out] Model    Register model.
+ * @param[in]     IRQn     Interrupt number.
+ * @param[in]     Pending  1 to pend, 0 to clear.
+ * @return uint8_t Previous state of the pending bit.
+ */
+uint8_t NVIC_Model_SetPending(NVIC_Model_t* Model, IRQn_Type IRQn, uint8_t Pending);
+
+/**
+ * @brief Sets the priority of an IRQ, values above 15 are clamped.
+ *
+ * @param[in,out] Model     Register model.
+ * @param[in]     IRQn      Interrupt number.
+ * @param[in]     Priority  Priority level.
+ */
+void NVIC_Model_SetPriority(NVIC_Model_t* Model, IRQn_Type IRQn, uint32_t Priority);
+
+/**
+ * @brief Reads one bit of the Enabled, Pending or Active words.
+ *
+ * @param[in] Words  Model->Enabled, Model->Pending or Model->Active.
+ * @param[in] IRQn   Interrupt number.
+ * @return uint8_t 1 when the bit is set, 0 otherwise.
+ */
+uint8_t NVIC_Model_GetBit(const volatile uint32_t* Words, IRQn_Type IRQn);
+
+/**
+ * @brief Reports whether an IRQ is enabled, pending and not active.
+ *
+ * @param[in] Model  Register model.
+ * @param[in] IRQn   Interrupt number.
+ * @return uint8_t 1 when the IRQ would be taken by a core running below its priority.
+ */
+uint8_t NVIC_Model_IsDeliverable(const NVIC_Model_t* Model, IRQn_Type IRQn);
+
+/**
+ * @brief Finds the IRQ the hardware would take next among one priority level.
+ *
+ * @param[in] Model  Register model.
+ * @param[in] Level  Priority level 0-15.
+ * @return int32_t The lowest numbered deliverable IRQ of that level, or NVIC_MODEL_NONE.
+ */
+int32_t NVIC_Model_NextAtLevel(const NVIC_Model_t* Model, uint32_t Level);
+
+/**
+ * @brief Finds the IRQ the hardware would take next across every level.
+ *
+ * @param[in] Model         Register model.
+ * @param[in] BelowLevel    Only levels numerically below this one are considered, i.e. the
+ *                          IRQs able to preempt code running at BelowLevel
+ *                          (NVIC_MODEL_LEVELS to consider all of them).
+ * @return int32_t The deliverable IRQ with the best (priority, number) pair, or NVIC_MODEL_NONE.
+ */
+int32_t NVIC_Model_Next(const NVIC_Model_t* Model, uint32_t BelowLevel);
+
+/**
+ * @brief Enters the handler of an IRQ: clears its pending bit and sets its active bit.
+ *
+ * @param[in,out] Model  Register model.
+ * @param[in]     IRQn   Interrupt number.
+ */
+void NVIC_Model_Activate(NVIC_Model_t* Model, IRQn_Type IRQn);
+
+/**
+ * @brief Leaves the handler of an IRQ: clears its active bit.
+ *
+ * @param[in,out] Model  Register model.
+ * @param[in]     IRQn   Interrupt number.
+ */
+void NVIC_Model_Deactivate(NVIC_Model_t* Model, IRQn_Type IRQn);
+
+#endif /* NVIC_MODEL_INTERFACE_H */
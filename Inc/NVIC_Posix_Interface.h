@@ -0,0 +1,128 @@
+/**
+ * @file NVIC_Posix_Interface.h
+ * @brief Interface for the POSIX (Linux) port of the NVIC driver.
+ *
+ * This file provides the host-only services of the port that implements NVIC_Interface.h
+ * on Linux. The thread calling NVIC_Posix_Init() plays the CPU: each of the 16 priority
+ * levels is a real-time signal delivered to that thread, and the handler of a level runs
+ * with its own and every lower-urgency level blocked. Interrupts of a more urgent level
+ * therefore genuinely preempt running handlers, exactly as on the NVIC. The enable,
+ * pending, active and priority state lives in an NVIC_Model_t that simulated peripherals
+ * on other threads may inspect; they raise interrupts with NVIC_SetPendingIRQ().
+ *
+ * Host builds compile NVIC_Posix_Program.c and NVIC_Model_Program.c in place of
+ * NVIC_Program.c and link with -pthread.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef NVIC_POSIX_INTERFACE_H
+#define NVIC_POSIX_INTERFACE_H
+
+#include <stdint.h>
+#include "NVIC_Interface.h"
+#include "NVIC_Model_Interface.h"
+
+/**
+ * @brief Interrupt handler registered for an IRQ.
+ */
+typedef void (*NVIC_Posix_Handler_t)(void);
+
+/**
+ * @enum NVIC_Posix_Event_t
+ * @brief Events reported to the hook.
+ */
+typedef enum
+{
+    NVIC_POSIX_EVENT_PEND = 0,   /**< NVIC_SetPendingIRQ() called, before the pending bit is set */
+    NVIC_POSIX_EVENT_ENTER,      /**< Handler about to run, active bit set */
+    NVIC_POSIX_EVENT_EXIT,       /**< Handler returned, active bit still set */
+    NVIC_POSIX_EVENT_SYNC        /**< Sync point of the synchronous mode, IRQn is NVIC_MODEL_NONE */
+} NVIC_Posix_Event_t;
+
+/**
+ * @brief Observer of the port's events.
+ *
+ * Called on the thread that caused the event; Local is 1 on the CPU thread. For
+ * NVIC_POSIX_EVENT_PEND, returning 0 drops the pend (the hook may apply it later through
+ * the model), any other event ignores the return value.
+ */
+typedef uint8_t (*NVIC_Posix_Hook_t)(NVIC_Posix_Event_t Event, int32_t IRQn, uint8_t Local);
+
+/**
+ * @brief Makes the calling thread the emulated CPU and installs the level signal handlers.
+ *
+ * Resets the register model. Must be called before any other NVIC function.
+ *
+ * @return uint8_t OK on success, NOK when the real-time signals are not available.
+ */
+uint8_t NVIC_Posix_Init(void);
+
+/**
+ * @brief Registers the handler run when an IRQ is taken.
+ *
+ * @param[in] IRQn     Interrupt number.
+ * @param[in] Handler  Handler, NULL to remove it (a taken IRQ then only clears its pending bit).
+ */
+void NVIC_Posix_SetHandler(IRQn_Type IRQn, NVIC_Posix_Handler_t Handler);
+
+/**
+ * @brief Returns the register model shared by the port and the simulated peripherals.
+ *
+ * @return NVIC_Model_t* The model.
+ */
+NVIC_Model_t* NVIC_Posix_GetModel(void);
+
+/**
+ * @brief Installs the observer called on every pend, handler entry, handler exit and sync point.
+ *
+ * @param[in] Hook  Observer, NULL to remove it.
+ */
+void NVIC_Posix_SetHook(NVIC_Posix_Hook_t Hook);
+
+/**
+ * @brief Selects signal-driven (asynchronous) or sync-point (synchronous) delivery.
+ *
+ * In the synchronous mode no signal is sent: interrupts are only taken on the CPU thread
+ * at sync points, which are the end of every NVIC_Interface.h call made by that thread,
+ * NVIC_Posix_EnableInterrupts(), NVIC_Posix_SetBasePri(), every polling round of
+ * NVIC_Posix_WaitForInterrupt() and explicit NVIC_Posix_DispatchPending() calls. The
+ * interleaving of handlers with the firmware then depends only on the order of the pends,
+ * which makes runs reproducible. The default is the asynchronous mode.
+ *
+ * @param[in] Synchronous  1 for sync-point delivery, 0 for signal delivery.
+ */
+void NVIC_Posix_SetSynchronous(uint8_t Synchronous);
+
+/**
+ * @brief Sync point: runs, on the CPU thread, every IRQ able to preempt the current context.
+ *
+ * Firmware loops that poll memory rather than NVIC state call it to give interrupts a
+ * chance in the synchronous mode. Calls from other threads are ignored.
+ */
+void NVIC_Posix_DispatchPending(void);
+
+/**
+ * @brief Masks every interrupt on the CPU thread (equivalent of PRIMASK = 1).
+ */
+void NVIC_Posix_DisableInterrupts(void);
+
+/**
+ * @brief Unmasks the interrupts masked by NVIC_Posix_DisableInterrupts().
+ */
+void NVIC_Posix_EnableInterrupts(void);
+
+/**
+ * @brief Masks the levels numerically >= Level on the CPU thread (equivalent of BASEPRI).
+ *
+ * @param[in] Level  Priority threshold 1-15, 0 removes the mask.
+ */
+void NVIC_Posix_SetBasePri(uint32_t Level);
+
+/**
+ * @brief Sleeps until an interrupt has been handled (equivalent of WFI).
+ */
+void NVIC_Posix_WaitForInterrupt(void);
+
+#endif /* NVIC_POSIX_INTERFACE_H */
@@ -0,0 +1,7 @@
+#ifndef NVIC_POSIX_PRIVATE_H
+#define NVIC_POSIX_PRIVATE_H
+
+#define NVIC_POSIX_SIGNAL(Level)    (SIGRTMIN + (int)(Level))   /**< Real-time signal carrying a priority level */
+#define NVIC_POSIX_IDLE_POLL_NS     100000L                     /**< Idle polling period of the synchronous mode */
+
+#endif /*NVIC_POSIX_PRIVATE_H*/
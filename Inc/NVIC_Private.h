@@ -1,9 +1,16 @@
 #ifndef NVIC_PRIVATE_H
 #define NVIC_PRIVATE_H
 
+/* Boot profiler hooks, compiled in with -DNVIC_BOOTPROF */
+#ifdef NVIC_BOOTPROF
+#include "BOOTPROF_Interface.h"
+#define NVIC_BOOTPROF_HOOK(Event, IRQn, Value)    BOOTPROF_Hook((Event), (IRQn), (Value))
+#else
+#define NVIC_BOOTPROF_HOOK(Event, IRQn, Value)    ((void)0)
+#endif
 
-
-
-
+#define NVIC_ICSR_VECTPENDING_POS     12U        /**< SCB ICSR pending exception number field */
+#define NVIC_ICSR_VECTPENDING_MASK    0x1FFUL
+#define NVIC_EXCEPTION_OFFSET         16         /**< Exception number of IRQ 0 */
 
 #endif /*NVIC_PRIVATE_H*/
\ No newline at end of file
@@ -0,0 +1,113 @@
+/**
+ * @file NVIC_Replay_Interface.h
+ * @brief Interface for the deterministic record/replay of interrupts on the POSIX port.
+ *
+ * This file provides a recorder that logs the logical time and order of every pend and
+ * handler entry/exit of a host run, and a replayer that reproduces them exactly. Both put
+ * the port in its synchronous mode, where interrupts are only taken at sync points; the
+ * logical time is the number of sync points reached by the CPU thread.
+ *
+ * While recording, pends from simulated peripherals (other threads) are queued and applied
+ * at the next sync point, so each one lands at a well defined logical time. While
+ * replaying, pends from other threads are dropped and the logged ones are applied at their
+ * logical time instead; the handler entries, exits and firmware pends are checked against
+ * the log. A soak-test run can thus be replayed under a debugger, with a breakpoint on
+ * NVIC_Replay_Breakpoint() to stop at a chosen logical time or at the first divergence.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef NVIC_REPLAY_INTERFACE_H
+#define NVIC_REPLAY_INTERFACE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include "NVIC_Posix_Interface.h"
+
+/**
+ * @enum NVIC_Replay_Mode_t
+ * @brief State of the recorder/replayer.
+ */
+typedef enum
+{
+    NVIC_REPLAY_OFF = 0,     /**< Not started or stopped */
+    NVIC_REPLAY_RECORDING,   /**< Logging the run */
+    NVIC_REPLAY_REPLAYING,   /**< Reproducing a log */
+    NVIC_REPLAY_FINISHED     /**< Log exhausted or run diverged, peripherals are live again */
+} NVIC_Replay_Mode_t;
+
+/**
+ * @struct NVIC_Replay_Record_t
+ * @brief One log entry; the log is a header word (NVIC_REPLAY_MAGIC) followed by records.
+ */
+typedef struct
+{
+    uint32_t Time;       /**< Logical time (sync point count) */
+    uint8_t  Event;      /**< NVIC_Posix_Event_t: PEND, ENTER or EXIT */
+    uint8_t  IRQn;       /**< Interrupt number */
+    uint8_t  Local;      /**< 1 when pended by the firmware, 0 by a simulated peripheral */
+    uint8_t  Reserved;
+} NVIC_Replay_Record_t;
+
+#define NVIC_REPLAY_MAGIC      0x4E525031UL   /**< "NRP1" */
+
+/**
+ * @struct NVIC_Replay_Status_t
+ * @brief Progress of the recording or replay.
+ */
+typedef struct
+{
+    NVIC_Replay_Mode_t Mode;
+    uint32_t Time;         /**< Current logical time */
+    uint32_t Records;      /**< Records written or matched */
+    uint32_t Dropped;      /**< Peripheral pends lost to a full queue while recording */
+    uint8_t  Diverged;     /**< 1 when the replay departed from the log */
+    uint32_t DivergedAt;   /**< Logical time of the divergence */
+} NVIC_Replay_Status_t;
+
+/**
+ * @brief Starts logging the run to a binary file.
+ *
+ * Call after NVIC_Posix_Init() and before the simulated peripherals start.
+ *
+ * @param[in] Log  File open for binary writing, owned by the caller.
+ * @return uint8_t OK on success, NULL_PTR_ERR on a NULL argument, NOK when already running.
+ */
+uint8_t NVIC_Replay_StartRecording(FILE* Log);
+
+/**
+ * @brief Starts reproducing a log written by NVIC_Replay_StartRecording().
+ *
+ * @param[in] Log  File open for binary reading, owned by the caller.
+ * @return uint8_t OK on success, NULL_PTR_ERR on a NULL argument, NOK when already running
+ *                 or when the file is not a log.
+ */
+uint8_t NVIC_Replay_StartReplay(FILE* Log);
+
+/**
+ * @brief Stops recording or replaying and returns the port to signal delivery.
+ */
+void NVIC_Replay_Stop(void);
+
+/**
+ * @brief Asks for NVIC_Replay_Breakpoint() to be called when the logical time reaches Time.
+ *
+ * @param[in] Time  Logical time, 0 to disable.
+ */
+void NVIC_Replay_BreakAt(uint32_t Time);
+
+/**
+ * @brief Retrieves the progress of the recording or replay.
+ *
+ * @param[out] Status  Progress.
+ * @return uint8_t OK on success, NULL_PTR_ERR on a NULL argument.
+ */
+uint8_t NVIC_Replay_GetStatus(NVIC_Replay_Status_t* Status);
+
+/**
+ * @brief Called at the requested logical time and at the first divergence; set a debugger breakpoint here.
+ */
+void NVIC_Replay_Breakpoint(void);
+
+#endif /* NVIC_REPLAY_INTERFACE_H */
@@ -0,0 +1,15 @@
+#ifndef NVIC_REPLAY_PRIVATE_H
+#define NVIC_REPLAY_PRIVATE_H
+
+#define NVIC_REPLAY_QUEUE_SIZE     256U   /**< Peripheral pends held between two sync points, power of two */
+
+/**
+ * @brief Peripheral pend waiting for the next sync point.
+ */
+typedef struct
+{
+    volatile uint8_t Full;
+    uint8_t IRQn;
+} NVIC_Replay_Slot_t;
+
+#endif /*NVIC_REPLAY_PRIVATE_H*/
@@ -0,0 +1,113 @@
+/**
+ * @file PERF_Interface.h
+ * @brief Interface for the per-ISR DWT performance counters.
+ *
+ * This file provides hooks that snapshot the DWT cycle, CPI, LSU, sleep, folded-instruction
+ * and exception-overhead counters at the entry and exit of selected interrupt handlers,
+ * and accumulate the differences per IRQ. A handler preempted by another selected handler
+ * is not charged for it. The exception entry/exit overhead (stacking, unstacking,
+ * tail-chaining) is not part of any handler and is reported on its own.
+ *
+ * The split tells a bus-bound handler from a compute-bound one: LsuCycles counts the wait
+ * states of loads and stores (peripheral and PPB accesses such as NVIC_SetPriority()),
+ * CpiCycles the extra cycles of multi-cycle instructions (divides, multiplies, branches).
+ * The executed instruction count is about Cycles - CpiCycles - LsuCycles - SleepCycles + Folded.
+ *
+ * The CPI, LSU, sleep, fold and exception counters are 8 bits wide, so a difference is
+ * only exact when the counter moved by less than 256 between two samples. Samples longer
+ * than 255 cycles are counted in Ambiguous; long handlers should call PERF_Checkpoint()
+ * inside their loops to keep every sample short. EXCCNT is sampled across thread-mode
+ * gaps too, so the overhead has its own Ambiguous count; a periodic PERF_Checkpoint()
+ * (e.g. from a selected timer handler) bounds those gaps.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef PERF_INTERFACE_H
+#define PERF_INTERFACE_H
+
+#include <stdint.h>
+#include "NVIC_Interface.h"
+
+/**
+ * @struct PERF_IsrStats_t
+ * @brief Counters accumulated over the runs of one handler, nested selected handlers excluded.
+ */
+typedef struct
+{
+    uint32_t Count;          /**< Completed runs */
+    uint32_t Cycles;         /**< CPU cycles */
+    uint32_t CpiCycles;      /**< Extra cycles of multi-cycle instructions */
+    uint32_t LsuCycles;      /**< Extra cycles of loads and stores */
+    uint32_t SleepCycles;    /**< Cycles spent sleeping */
+    uint32_t Folded;         /**< Instructions executed in zero cycles */
+    uint32_t Ambiguous;      /**< Samples of 256 cycles or more, where 8-bit counters may have wrapped */
+} PERF_IsrStats_t;
+
+/**
+ * @struct PERF_Overhead_t
+ * @brief Exception entry and exit overhead seen between the samples.
+ */
+typedef struct
+{
+    uint32_t ExceptionCycles;   /**< EXCCNT cycles: stacking, unstacking and tail-chaining */
+    uint32_t Entries;           /**< Entries of selected handlers */
+    uint32_t Ambiguous;         /**< Samples 256 cycles or more apart, where EXCCNT may have wrapped */
+} PERF_Overhead_t;
+
+/**
+ * @brief Enables the DWT counters and clears every statistic and selection.
+ */
+void PERF_Init(void);
+
+/**
+ * @brief Selects or deselects an IRQ for profiling.
+ *
+ * @param[in] IRQn    Interrupt number.
+ * @param[in] Enable  1 to profile the IRQ, 0 to ignore its hooks.
+ */
+void PERF_Select(IRQn_Type IRQn, uint8_t Enable);
+
+/**
+ * @brief Samples the counters at handler entry; call it first thing in the handler.
+ *
+ * @param[in] IRQn  Interrupt being served.
+ */
+void PERF_IsrEnter(IRQn_Type IRQn);
+
+/**
+ * @brief Samples the counters at handler exit; call it last thing in the handler.
+ *
+ * @param[in] IRQn  Interrupt being served.
+ */
+void PERF_IsrExit(IRQn_Type IRQn);
+
+/**
+ * @brief Folds the counters into the running handler's statistics, to keep samples short.
+ */
+void PERF_Checkpoint(void);
+
+/**
+ * @brief Retrieves the statistics of one IRQ.
+ *
+ * @param[in]  IRQn   Interrupt number.
+ * @param[out] Stats  Copy of the statistics.
+ * @return uint8_t OK on success, NULL_PTR_ERR on a NULL argument.
+ */
+uint8_t PERF_GetStats(IRQn_Type IRQn, PERF_IsrStats_t* Stats);
+
+/**
+ * @brief Retrieves the exception overhead.
+ *
+ * @param[out] Overhead  Copy of the overhead counters.
+ * @return uint8_t OK on success, NULL_PTR_ERR on a NULL argument.
+ */
+uint8_t PERF_GetOverhead(PERF_Overhead_t* Overhead);
+
+/**
+ * @brief Clears every statistic, keeping the selection.
+ */
+void PERF_Reset(void);
+
+#endif /* PERF_INTERFACE_H */
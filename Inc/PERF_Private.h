@@ -0,0 +1,21 @@
+#ifndef PERF_PRIVATE_H
+#define PERF_PRIVATE_H
+
+#define PERF_MAX_DEPTH        16U      /**< Nesting depth, one handler per priority level */
+#define PERF_COUNTER8_MASK    0xFFU    /**< Width of the CPI, EXC, SLEEP, LSU and FOLD counters */
+
+/**
+ * @struct PERF_Snapshot_t
+ * @brief Raw DWT counter values.
+ */
+typedef struct
+{
+    uint32_t Cycles;
+    uint32_t Cpi;
+    uint32_t Exc;
+    uint32_t Sleep;
+    uint32_t Lsu;
+    uint32_t Fold;
+} PERF_Snapshot_t;
+
+#endif /*PERF_PRIVATE_H*/
@@ -0,0 +1,121 @@
+/**
+ * @file PRIOPROF_Interface.h
+ * @brief Interface for the binary interrupt priority profiles.
+ *
+ * This file provides a compact profile format that sets the priority of a chosen set of
+ * IRQs, a USART receiver for it, its storage in a flash sector and a bounded-time apply
+ * step that only writes the priorities that change.
+ *
+ * Profile layout, little endian:
+ *   - Magic (4 bytes, PRIOPROF_MAGIC), Version (1 byte), Count (1 byte), Reserved (2 bytes, 0)
+ *   - IRQ bitmap, 4 words: bit n of word w selects IRQ 32 * w + n; Count bits are set
+ *   - Priorities, 4 bits each, in ascending IRQ order, low nibble first: (Count + 1) / 2 bytes
+ *   - CRC-32 (IEEE 802.3, as zlib) of every byte before it
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef PRIOPROF_INTERFACE_H
+#define PRIOPROF_INTERFACE_H
+
+#include <stdint.h>
+#include "NVIC_Interface.h"
+#include "../../../LIB/STM32F446xx.h"
+
+#define PRIOPROF_MAGIC             0x46525050UL   /**< "PPRF" */
+#define PRIOPROF_VERSION           1U
+#define PRIOPROF_HEADER_SIZE       24U            /**< Magic, version, count, reserved and bitmap */
+#define PRIOPROF_SIZE(Count)       (PRIOPROF_HEADER_SIZE + (((uint32_t)(Count) + 1U) / 2U) + 4U)
+#define PRIOPROF_MAX_SIZE          PRIOPROF_SIZE(NVIC_IRQ_COUNT)
+
+/**
+ * @enum PRIOPROF_RxStatus_t
+ * @brief State of the profile receiver.
+ */
+typedef enum
+{
+    PRIOPROF_RX_WAITING = 0,   /**< Looking for the magic */
+    PRIOPROF_RX_RECEIVING,     /**< Inside a profile */
+    PRIOPROF_RX_READY,         /**< A complete, valid profile was received */
+    PRIOPROF_RX_ERROR          /**< The last profile was malformed or failed its CRC */
+} PRIOPROF_RxStatus_t;
+
+/**
+ * @brief Restarts the receiver, dropping any partial or received profile.
+ */
+void PRIOPROF_RxReset(void);
+
+/**
+ * @brief Feeds one received byte to the receiver.
+ *
+ * Bytes are ignored while a received profile waits to be collected with
+ * PRIOPROF_GetReceived() or dropped with PRIOPROF_RxReset().
+ *
+ * @param[in] Byte  Received byte.
+ * @return PRIOPROF_RxStatus_t Receiver state after the byte.
+ */
+PRIOPROF_RxStatus_t PRIOPROF_RxByte(uint8_t Byte);
+
+/**
+ * @brief Feeds every byte waiting in a USART data register; call it from the USART IRQ (RXNEIE).
+ *
+ * @param[in] USARTx  USART receiving the profile.
+ * @return PRIOPROF_RxStatus_t Receiver state after the bytes.
+ */
+PRIOPROF_RxStatus_t PRIOPROF_RxUsart(USART_RegDef_t* USARTx);
+
+/**
+ * @brief Returns the received profile.
+ *
+ * @param[out] Length  Size of the profile in bytes.
+ * @return const uint8_t* The profile, or NULL when none is ready.
+ */
+const uint8_t* PRIOPROF_GetReceived(uint32_t* Length);
+
+/**
+ * @brief Checks the layout and CRC of a profile.
+ *
+ * @param[in] Profile  Profile bytes.
+ * @param[in] Length   Number of bytes available.
+ * @return uint8_t OK when the profile is valid, NOK otherwise, NULL_PTR_ERR on a NULL argument.
+ */
+uint8_t PRIOPROF_Validate(const uint8_t* Profile, uint32_t Length);
+
+/**
+ * @brief Erases the profile flash sector and programs a validated profile into it.
+ *
+ * Erasing stalls instruction fetches from flash for the erase time; call it from thread
+ * mode, outside any deadline. The sector is PRIOPROF_FLASH_SECTOR, which must be kept
+ * out of the image by the linker script. The flash data cache is flushed before the
+ * stored copy is read back, so no line cached before the erase is checked.
+ *
+ * @param[in] Profile  Profile bytes.
+ * @param[in] Length   Number of bytes.
+ * @return uint8_t OK when the stored copy reads back valid, NOK otherwise, NULL_PTR_ERR on a NULL argument.
+ */
+uint8_t PRIOPROF_Store(const uint8_t* Profile, uint32_t Length);
+
+/**
+ * @brief Returns the profile stored in flash.
+ *
+ * @return const uint8_t* The stored profile, or NULL when the sector holds no valid profile.
+ */
+const uint8_t* PRIOPROF_GetStored(void);
+
+/**
+ * @brief Applies a validated profile, writing only the priorities that change.
+ *
+ * Runs with BASEPRI raised to Ceiling: interrupts of priority 0 to Ceiling - 1 stay
+ * enabled, the others wait for the end of the apply. The time is bounded by one
+ * compare and at most one byte write per IRQ of the profile.
+ *
+ * @param[in]  Profile  Profile bytes.
+ * @param[in]  Ceiling  First masked priority, 1-15 (0 masks nothing).
+ * @param[out] Changed  Number of priorities written, may be NULL.
+ * @return uint8_t OK on success, NOK when the profile is invalid or Ceiling is above 15,
+ *                 NULL_PTR_ERR on a NULL profile.
+ */
+uint8_t PRIOPROF_Apply(const uint8_t* Profile, uint8_t Ceiling, uint32_t* Changed);
+
+#endif /* PRIOPROF_INTERFACE_H */
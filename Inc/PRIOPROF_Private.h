@@ -0,0 +1,48 @@
+#ifndef PRIOPROF_PRIVATE_H
+#define PRIOPROF_PRIVATE_H
+
+/*
+ * Flash sector holding the stored profile. There is no default: PRIOPROF_Store() erases
+ * it whole, so the application picks a sector its linker script keeps out of the image
+ * and defines its number, 1 to 7, on the command line. Sector 0 holds the vector table.
+ */
+#ifndef PRIOPROF_FLASH_SECTOR
+#error "Define PRIOPROF_FLASH_SECTOR to a flash sector (1 to 7) reserved in the linker script"
+#endif
+
+/* Sectors 0-3 are 16 KB, sector 4 is 64 KB, sectors 5-7 are 128 KB */
+#define PRIOPROF_FLASH_ADDRESS     ((PRIOPROF_FLASH_SECTOR < 4U) ? \
+                                    (FLASH_BASE_ADDRESS + ((uint32_t)PRIOPROF_FLASH_SECTOR * 0x4000UL)) : \
+                                    (PRIOPROF_FLASH_SECTOR == 4U) ? (FLASH_BASE_ADDRESS + 0x10000UL) : \
+                                    (FLASH_BASE_ADDRESS + 0x20000UL + (((uint32_t)PRIOPROF_FLASH_SECTOR - 5U) * 0x20000UL)))
+
+#define PRIOPROF_CRC32_POLY        0xEDB88320UL   /**< Reflected IEEE 802.3 polynomial */
+#define PRIOPROF_MAX_CEILING       15U            /**< Highest ceiling BASEPRI can hold */
+
+/* Profile field offsets */
+#define PRIOPROF_OFFSET_VERSION    4U
+#define PRIOPROF_OFFSET_COUNT      5U
+#define PRIOPROF_OFFSET_RESERVED   6U
+#define PRIOPROF_OFFSET_BITMAP     8U
+#define PRIOPROF_BITMAP_WORDS      4U
+#define PRIOPROF_FIXED_SIZE        8U             /**< Bytes before the bitmap */
+
+/* FLASH interface keys and bits */
+#define PRIOPROF_FLASH_KEY1        0x45670123UL
+#define PRIOPROF_FLASH_KEY2        0xCDEF89ABUL
+#define PRIOPROF_FLASH_CR_PG       0U
+#define PRIOPROF_FLASH_CR_SER      1U
+#define PRIOPROF_FLASH_CR_SNB      3U
+#define PRIOPROF_FLASH_CR_PSIZE    8U
+#define PRIOPROF_FLASH_PSIZE_X32   2U             /**< Word programming, 2.7 V to 3.6 V supply */
+#define PRIOPROF_FLASH_CR_STRT     16U
+#define PRIOPROF_FLASH_CR_LOCK     31U
+#define PRIOPROF_FLASH_SR_BSY      16U
+#define PRIOPROF_FLASH_SR_ERRORS   0xF2UL         /**< OPERR, WRPERR, PGAERR, PGPERR, PGSERR */
+#define PRIOPROF_FLASH_ACR_DCEN    10U            /**< Data cache enable */
+#define PRIOPROF_FLASH_ACR_DCRST   12U            /**< Data cache reset, writable with DCEN clear */
+
+/* USART status bit */
+#define PRIOPROF_USART_SR_RXNE     5U
+
+#endif /*PRIOPROF_PRIVATE_H*/
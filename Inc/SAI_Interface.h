@@ -0,0 +1,181 @@
+/**
+ * @file SAI_Interface.h
+ * @brief Interface for the SAI audio streaming driver.
+ *
+ * This file provides the function declarations required to stream stereo audio through
+ * an SAI block with a circular, double-buffered DMA. Each half-buffer event pends a
+ * software interrupt in which the application processes the block, and the driver
+ * measures how close every block came to its deadline. A block that is still waiting
+ * when the DMA needs its half again is an underrun; the driver then records which
+ * interrupts were active so the delay can be attributed.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef SAI_INTERFACE_H
+#define SAI_INTERFACE_H
+
+#include <stdint.h>
+#include "NVIC_Interface.h"
+
+#define SAI_NO_CULPRIT      (-1)     /**< Underrun seen with no other interrupt active */
+
+/**
+ * @enum SAI_Block_t
+ * @brief Audio block (sub-block A or B of SAI1/SAI2).
+ */
+typedef enum
+{
+    SAI1_BLOCK_A = 0U,
+    SAI1_BLOCK_B,
+    SAI2_BLOCK_A,
+    SAI2_BLOCK_B
+} SAI_Block_t;
+
+/**
+ * @enum SAI_Mode_t
+ * @brief Role of the audio block, value of the CR1.MODE field.
+ */
+typedef enum
+{
+    SAI_MASTER_TX = 0U,
+    SAI_MASTER_RX = 1U,
+    SAI_SLAVE_TX  = 2U,
+    SAI_SLAVE_RX  = 3U
+} SAI_Mode_t;
+
+/**
+ * @brief Block processing callback, run from the pended processing interrupt.
+ *
+ * @param[in,out] Samples      Interleaved stereo samples of the half-buffer to process.
+ * @param[in]     SampleCount  Number of samples (frames * 2).
+ * @param[in]     Context      Pointer given in the configuration.
+ */
+typedef void (*SAI_Process_t)(void* Samples, uint16_t SampleCount, void* Context);
+
+/**
+ * @struct SAI_Config_t
+ * @brief Configuration of an audio stream (I2S framing, two slots).
+ */
+typedef struct
+{
+    SAI_Block_t   Block;           /**< Audio block to use */
+    SAI_Mode_t    Mode;            /**< Master/slave, transmit/receive */
+    uint8_t       SampleBits;      /**< 16 or 32 bits per sample (32-bit slots carry 24-bit audio) */
+    uint8_t       MasterClockDiv;  /**< CR1.MCKDIV value in master mode */
+    void*         Buffer;          /**< Circular buffer of 2 * FramesPerBlock stereo frames */
+    uint16_t      FramesPerBlock;  /**< Frames per half-buffer, at most 16383 */
+    uint32_t      SampleRateHz;    /**< Frame rate, used to compute the block deadline */
+    uint32_t      CoreClockHz;     /**< CPU clock, the unit of the DWT cycle counter, non-zero */
+    uint8_t       DmaStream;       /**< DMA2 stream routed to the block */
+    uint8_t       DmaChannel;      /**< DMA2 channel selecting the block on that stream */
+    IRQn_Type     DmaIRQ;          /**< Vector of that DMA stream */
+    uint8_t       DmaPriority;     /**< NVIC priority of the DMA interrupt, above ProcessPriority */
+    IRQn_Type     ProcessIRQ;      /**< Unused peripheral line pended to run the processing */
+    uint8_t       ProcessPriority; /**< NVIC priority of the processing interrupt */
+    SAI_Process_t Process;         /**< Block processing callback */
+    void*         Context;         /**< Callback argument */
+} SAI_Config_t;
+
+/**
+ * @struct SAI_Underrun_t
+ * @brief Snapshot taken when a block missed its deadline.
+ */
+typedef struct
+{
+    uint32_t Timestamp;                 /**< DWT cycle counter at detection */
+    uint32_t Block;                     /**< Index of the half-buffer event that found the previous block unfinished */
+    int32_t  Culprit;                   /**< IRQ blamed for the delay, or SAI_NO_CULPRIT */
+    uint8_t  ProcessingRunning;         /**< 1 when the processing had started but not finished */
+    uint32_t Active[NVIC_IRQ_WORDS];    /**< NVIC IABR words at detection */
+    uint32_t Pending[NVIC_IRQ_WORDS];   /**< NVIC ISPR words at detection */
+} SAI_Underrun_t;
+
+/**
+ * @struct SAI_DeadlineStats_t
+ * @brief Deadline instrumentation, all times in CPU cycles.
+ */
+typedef struct
+{
+    uint32_t Blocks;                /**< Half-buffer events seen */
+    uint32_t Processed;             /**< Blocks processed */
+    int32_t  LastSlack;             /**< Deadline minus completion time of the last block */
+    int32_t  MinSlack;              /**< Worst slack seen, negative values are late blocks */
+    uint32_t MaxStartLatency;       /**< Worst delay from the DMA event to the start of processing */
+    uint32_t MaxProcessCycles;      /**< Worst duration of the processing callback */
+    uint32_t Underruns;             /**< Blocks not processed in time */
+    uint32_t FifoErrors;            /**< SAI FIFO overrun/underrun flags */
+    SAI_Underrun_t LastUnderrun;    /**< Snapshot of the most recent underrun */
+} SAI_DeadlineStats_t;
+
+/**
+ * @struct SAI_Handle_t
+ * @brief Run-time state of a stream, owned by the driver.
+ */
+typedef struct
+{
+    SAI_Config_t        Config;        /**< Copy of the configuration */
+    volatile uint8_t    ReadyHalf;     /**< Half-buffer waiting for processing, 0xFF when none */
+    volatile uint8_t    Busy;          /**< 1 while the processing callback runs */
+    volatile uint32_t   EventTime;     /**< DWT time of the half-buffer event of the ready block */
+    uint32_t            BlockCycles;   /**< Duration of one half-buffer in CPU cycles */
+    SAI_DeadlineStats_t Stats;         /**< Deadline instrumentation */
+} SAI_Handle_t;
+
+/**
+ * @brief Configures the SAI block, its DMA stream and both interrupts.
+ *
+ * The SAI kernel clock and pins must already be configured.
+ *
+ * @param[out] Handle  Stream state.
+ * @param[in]  Config  Stream configuration.
+ * @return uint8_t OK on success, NULL_PTR_ERR or NOK on invalid arguments.
+ */
+uint8_t SAI_Init(SAI_Handle_t* Handle, const SAI_Config_t* Config);
+
+/**
+ * @brief Starts the circular DMA and enables the audio block.
+ *
+ * @param[in,out] Handle  Stream state.
+ */
+void SAI_Start(SAI_Handle_t* Handle);
+
+/**
+ * @brief Disables the audio block and stops its DMA stream.
+ *
+ * @param[in,out] Handle  Stream state.
+ */
+void SAI_Stop(SAI_Handle_t* Handle);
+
+/**
+ * @brief Copies the deadline instrumentation and optionally resets it.
+ *
+ * @param[in,out] Handle  Stream state.
+ * @param[out]    Stats   Destination of the statistics.
+ * @param[in]     Reset   1 to restart the measurement window.
+ */
+void SAI_GetStats(SAI_Handle_t* Handle, SAI_DeadlineStats_t* Stats, uint8_t Reset);
+
+/**
+ * @brief DMA half/full transfer handler, call it from the vector of Config.DmaIRQ.
+ *
+ * @param[in,out] Handle  Stream state.
+ */
+void SAI_DmaIRQHandler(SAI_Handle_t* Handle);
+
+/**
+ * @brief Block processing handler, call it from the vector of Config.ProcessIRQ.
+ *
+ * @param[in,out] Handle  Stream state.
+ */
+void SAI_ProcessIRQHandler(SAI_Handle_t* Handle);
+
+/**
+ * @brief SAI interrupt handler counting FIFO overrun/underrun, call it from SAI1_IRQHandler/SAI2_IRQHandler.
+ *
+ * @param[in,out] Handle  Stream state.
+ */
+void SAI_IRQHandler(SAI_Handle_t* Handle);
+
+#endif /* SAI_INTERFACE_H */
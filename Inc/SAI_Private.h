@@ -0,0 +1,42 @@
+#ifndef SAI_PRIVATE_H
+#define SAI_PRIVATE_H
+
+#define SAI_NO_HALF               0xFFU       /**< ReadyHalf value when no block waits */
+
+/* RCC enable bits */
+#define SAI_RCC_APB2ENR_SAI1EN    22U
+#define SAI_RCC_APB2ENR_SAI2EN    23U
+#define SAI_RCC_AHB1ENR_DMA2EN    22U
+
+/* CR1 register bit positions */
+#define SAI_CR1_MODE              0U          /**< 2 bits */
+#define SAI_CR1_DS                5U          /**< 3 bits */
+#define SAI_CR1_CKSTR             9U
+#define SAI_CR1_SAIEN             16U
+#define SAI_CR1_DMAEN             17U
+#define SAI_CR1_MCKDIV            20U         /**< 4 bits */
+
+#define SAI_CR1_DS_16BIT          4U
+#define SAI_CR1_DS_32BIT          7U
+
+/* CR2 register */
+#define SAI_CR2_FTH_HALF          2U          /**< FIFO threshold: half full */
+#define SAI_CR2_FFLUSH            3U
+
+/* FRCR register bit positions */
+#define SAI_FRCR_FSALL            8U          /**< 7 bits, active frame length - 1 */
+#define SAI_FRCR_FSDEF            16U         /**< FS marks start of frame and channel side */
+#define SAI_FRCR_FSOFF            18U         /**< FS asserted one bit before the first bit (I2S) */
+
+/* SLOTR register bit positions */
+#define SAI_SLOTR_NBSLOT          8U          /**< 4 bits, slots - 1 */
+#define SAI_SLOTR_SLOTEN          16U         /**< 16 bits, one per slot */
+
+/* IMR, SR and CLRFR bit positions */
+#define SAI_SR_OVRUDR             0U
+
+#define SAI_SLOTS                 2U          /**< Stereo, I2S framing */
+
+#define SAI_MAX_FRAMES_PER_BLOCK  (0xFFFFU / (2U * SAI_SLOTS))   /**< Both halves must fit the 16-bit NDTR */
+
+#endif /*SAI_PRIVATE_H*/
@@ -0,0 +1,97 @@
+/**
+ * @file SDIO_Interface.h
+ * @brief Interface for the SDIO SD card block driver.
+ *
+ * This file provides the function declarations required to identify an SD card and
+ * to queue multi-block DMA reads and writes. Transfers complete through the SDIO and
+ * DMA2 Stream3 interrupts, which run at a configurable low NVIC priority so that
+ * card traffic never delays control interrupts.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef SDIO_INTERFACE_H
+#define SDIO_INTERFACE_H
+
+#include <stdint.h>
+
+#define SDIO_BLOCK_SIZE          512U   /**< Size of one card block in bytes */
+
+/**
+ * @brief Completion callback of a queued request.
+ *
+ * Called from the SDIO interrupt once the request has finished.
+ *
+ * @param[in] Status   OK when every block was transferred, NOK otherwise.
+ * @param[in] Context  Pointer given when the request was queued.
+ */
+typedef void (*SDIO_Callback_t)(uint8_t Status, void* Context);
+
+/**
+ * @struct SDIO_Config_t
+ * @brief Configuration of the SDIO driver.
+ */
+typedef struct
+{
+    uint8_t IrqPriority;     /**< NVIC priority (0-15) of the SDIO and DMA2 Stream3 interrupts */
+    uint8_t HighSpeed;       /**< 1 to switch the card to high speed mode (48 MHz bus clock) when supported */
+} SDIO_Config_t;
+
+/**
+ * @brief Powers the SDIO peripheral and identifies the card.
+ *
+ * Enables the SDIO and DMA2 clocks, runs the SD identification sequence in polling
+ * mode, selects the 4-bit bus and the transfer clock, then enables the SDIO and
+ * DMA2 Stream3 interrupts at the configured priority. The SDIO pins must already
+ * be configured in their alternate function and the 48 MHz clock must be running.
+ *
+ * @param[in] Config  Driver configuration.
+ * @return uint8_t OK when a card was identified, NOK or NULL_PTR_ERR otherwise.
+ */
+uint8_t SDIO_Init(const SDIO_Config_t* Config);
+
+/**
+ * @brief Queues a multi-block read.
+ *
+ * @param[in]  BlockAddress  First block to read.
+ * @param[out] Buffer        Word aligned destination of BlockCount * SDIO_BLOCK_SIZE bytes.
+ * @param[in]  BlockCount    Number of blocks, at least 1.
+ * @param[in]  Callback      Completion callback, may be NULL.
+ * @param[in]  Context       Pointer handed back to the callback.
+ * @return uint8_t OK when queued, NOK when the queue is full or arguments are invalid.
+ */
+uint8_t SDIO_ReadBlocks(uint32_t BlockAddress, uint8_t* Buffer, uint16_t BlockCount,
+                        SDIO_Callback_t Callback, void* Context);
+
+/**
+ * @brief Queues a multi-block write.
+ *
+ * @param[in] BlockAddress  First block to write.
+ * @param[in] Buffer        Word aligned source of BlockCount * SDIO_BLOCK_SIZE bytes.
+ * @param[in] BlockCount    Number of blocks, at least 1.
+ * @param[in] Callback      Completion callback, may be NULL.
+ * @param[in] Context       Pointer handed back to the callback.
+ * @return uint8_t OK when queued, NOK when the queue is full or arguments are invalid.
+ */
+uint8_t SDIO_WriteBlocks(uint32_t BlockAddress, const uint8_t* Buffer, uint16_t BlockCount,
+                         SDIO_Callback_t Callback, void* Context);
+
+/**
+ * @brief Reports whether requests are queued or in progress.
+ *
+ * @return uint8_t 1 while the driver is busy, 0 when idle.
+ */
+uint8_t SDIO_IsBusy(void);
+
+/**
+ * @brief SDIO interrupt handler, advances the transfer state machine.
+ */
+void SDIO_IRQHandler(void);
+
+/**
+ * @brief DMA2 Stream3 interrupt handler, completes the DMA side of a transfer.
+ */
+void DMA2_Stream3_IRQHandler(void);
+
+#endif /* SDIO_INTERFACE_H */
@@ -0,0 +1,118 @@
+#ifndef SDIO_PRIVATE_H
+#define SDIO_PRIVATE_H
+
+#define SDIO_QUEUE_DEPTH          8U          /**< Requests that can wait behind the active one */
+
+#define SDIO_DMA_STREAM           3U          /**< DMA2 stream serving SDIO */
+#define SDIO_DMA_CHANNEL          4U          /**< DMA2 request channel of SDIO */
+
+#define SDIO_INIT_CLKDIV          118U        /**< 48 MHz / (118 + 2) = 400 kHz identification clock */
+#define SDIO_TRANSFER_CLKDIV      0U          /**< 48 MHz / (0 + 2) = 24 MHz default speed clock */
+
+#define SDIO_CMD_TIMEOUT          0x00100000UL /**< Polling loops before a command is abandoned */
+#define SDIO_ACMD41_RETRIES       0x0000FFFFUL /**< ACMD41 rounds before the card is declared dead */
+#define SDIO_DATA_TIMEOUT         0x01000000UL /**< Data timeout in bus clock periods (about 350 ms at 48 MHz) */
+
+/* RCC enable bits */
+#define SDIO_RCC_APB2ENR_SDIOEN   11U
+#define SDIO_RCC_AHB1ENR_DMA2EN   22U
+
+/* POWER register */
+#define SDIO_POWER_ON             0x3U
+
+/* CLKCR register bit positions */
+#define SDIO_CLKCR_CLKEN          8U
+#define SDIO_CLKCR_BYPASS         10U
+#define SDIO_CLKCR_WIDBUS         11U         /**< 2 bits, 01 = 4-bit bus */
+
+/* CMD register bit positions */
+#define SDIO_CMD_WAITRESP         6U          /**< 2 bits */
+#define SDIO_CMD_CPSMEN           10U
+
+/* DCTRL register bit positions */
+#define SDIO_DCTRL_DTEN           0U
+#define SDIO_DCTRL_DTDIR          1U
+#define SDIO_DCTRL_DMAEN          3U
+#define SDIO_DCTRL_DBLOCKSIZE     4U          /**< 4 bits, block size = 2^value */
+#define SDIO_DCTRL_BLOCK_512      9U
+
+/* STA, ICR and MASK share the same bit positions */
+#define SDIO_STA_CCRCFAIL         0U
+#define SDIO_STA_DCRCFAIL         1U
+#define SDIO_STA_CTIMEOUT         2U
+#define SDIO_STA_DTIMEOUT         3U
+#define SDIO_STA_TXUNDERR         4U
+#define SDIO_STA_RXOVERR          5U
+#define SDIO_STA_CMDREND          6U
+#define SDIO_STA_CMDSENT          7U
+#define SDIO_STA_DATAEND          8U
+#define SDIO_STA_STBITERR         9U
+#define SDIO_STA_RXDAVL           21U
+
+#define SDIO_STATIC_FLAGS         0x00C007FFUL /**< Every clearable flag of ICR */
+#define SDIO_DATA_ERRORS          ((1UL << SDIO_STA_DCRCFAIL) | (1UL << SDIO_STA_DTIMEOUT) | \
+                                   (1UL << SDIO_STA_TXUNDERR) | (1UL << SDIO_STA_RXOVERR) | \
+                                   (1UL << SDIO_STA_STBITERR))
+#define SDIO_CMD_ERRORS           ((1UL << SDIO_STA_CCRCFAIL) | (1UL << SDIO_STA_CTIMEOUT))
+
+/* Response types, value of the WAITRESP field */
+#define SDIO_RESP_NONE            0U
+#define SDIO_RESP_SHORT           1U
+#define SDIO_RESP_LONG            3U
+
+/* SD commands used by the driver */
+#define SDIO_CMD0_GO_IDLE         0U
+#define SDIO_CMD2_ALL_SEND_CID    2U
+#define SDIO_CMD3_SEND_RCA        3U
+#define SDIO_CMD6_SWITCH_FUNC     6U
+#define SDIO_CMD7_SELECT          7U
+#define SDIO_CMD8_SEND_IF_COND    8U
+#define SDIO_CMD12_STOP           12U
+#define SDIO_CMD13_SEND_STATUS    13U
+#define SDIO_CMD16_SET_BLOCKLEN   16U
+#define SDIO_CMD18_READ_MULTI     18U
+#define SDIO_CMD25_WRITE_MULTI    25U
+#define SDIO_CMD55_APP_CMD        55U
+#define SDIO_ACMD6_BUS_WIDTH      6U
+#define SDIO_ACMD41_SEND_OP_COND  41U
+
+#define SDIO_CMD8_PATTERN         0x000001AAUL /**< 2.7-3.6 V, check pattern 0xAA */
+#define SDIO_ACMD41_ARG           0x40FF8000UL /**< HCS plus the 2.7-3.6 V window */
+#define SDIO_OCR_READY            31U
+#define SDIO_OCR_CCS              30U
+#define SDIO_CMD6_HIGH_SPEED      0x80FFFFF1UL /**< Switch function group 1 to high speed */
+#define SDIO_CMD6_STATUS_BYTES    64U
+
+#define SDIO_R1_READY_FOR_DATA    8U
+#define SDIO_R1_STATE             9U          /**< 4 bits */
+#define SDIO_R1_STATE_TRAN        4U
+#define SDIO_R1_ERRORS            0xFDF98008UL /**< R1 card status error bits */
+
+/**
+ * @enum SDIO_State_t
+ * @brief States of the interrupt driven transfer engine.
+ */
+typedef enum
+{
+    SDIO_STATE_IDLE = 0U,     /**< No request in progress */
+    SDIO_STATE_WAIT_READY,    /**< CMD13 sent, waiting for the card to leave programming */
+    SDIO_STATE_DATA_CMD,      /**< CMD18/CMD25 sent, waiting for its response */
+    SDIO_STATE_DATA,          /**< Data phase running under DMA */
+    SDIO_STATE_STOP           /**< CMD12 sent, waiting for its response */
+} SDIO_State_t;
+
+/**
+ * @struct SDIO_Request_t
+ * @brief A queued block transfer.
+ */
+typedef struct
+{
+    uint32_t        BlockAddress;  /**< First block */
+    uint8_t*        Buffer;        /**< Word aligned data buffer */
+    uint16_t        BlockCount;    /**< Number of blocks */
+    uint8_t         Write;         /**< 1 for a write, 0 for a read */
+    SDIO_Callback_t Callback;      /**< Completion callback */
+    void*           Context;       /**< Callback argument */
+} SDIO_Request_t;
+
+#endif /*SDIO_PRIVATE_H*/
@@ -0,0 +1,89 @@
+/**
+ * @file SEQLOCK_Interface.h
+ * @brief Sequence-latch template for parameter blocks written by tasks and read by ISRs.
+ *
+ * SEQLOCK_DEFINE(Name, Type) generates a lock type Name_t holding two copies of Type
+ * and the inline functions Name_Init(), Name_Write() and Name_Read().
+ *
+ * A plain seqlock does not work for an ISR reader: if the ISR preempts the writer in the
+ * middle of an update, it retries against a writer that cannot run until the ISR returns.
+ * This latch variant keeps two copies and the writer updates them one after the other,
+ * the sequence telling the reader which copy is stable. A reader preempting the writer
+ * therefore succeeds on its first attempt. A reader only retries when a writer preempts
+ * it, and the retry bound keeps its time fixed even then.
+ *
+ * Writers never mask interrupts. Writers of the same lock must not preempt each other.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef SEQLOCK_INTERFACE_H
+#define SEQLOCK_INTERFACE_H
+
+#include <stdint.h>
+#include "../../../LIB/CORE_Intrinsics.h"
+#include "../../../LIB/ErrType.h"
+
+#ifndef SEQLOCK_MAX_RETRIES
+#define SEQLOCK_MAX_RETRIES    4U   /**< Read attempts before Name_Read() gives up */
+#endif
+
+/**
+ * @brief Defines a latch named Name protecting a value of type Type.
+ *
+ * - void Name_Init(Name_t* Lock, const Type* Value): sets both copies, before any reader runs.
+ * - void Name_Write(Name_t* Lock, const Type* Value): publishes a new value; never blocks.
+ * - uint8_t Name_Read(Name_t* Lock, Type* Value): copies a consistent value out; OK, or
+ *   NOK after SEQLOCK_MAX_RETRIES attempts all overlapped by writes (Value is then torn).
+ *
+ * The barriers order the sequence and data accesses for the compiler and the core; a
+ * single Cortex-M4 needs nothing stronger.
+ */
+#define SEQLOCK_DEFINE(Name, Type)                                                  \
+    typedef struct                                                                  \
+    {                                                                               \
+        volatile uint32_t Sequence;   /**< Odd while copy 0 is written */           \
+        Type Copy[2];                                                               \
+    } Name##_t;                                                                     \
+                                                                                    \
+    static inline void Name##_Init(Name##_t* Lock, const Type* Value)               \
+    {                                                                               \
+        Lock->Copy[0] = *Value;                                                     \
+        Lock->Copy[1] = *Value;                                                     \
+        CORE_DMB();                                                                 \
+        Lock->Sequence = 0U;                                                        \
+    }                                                                               \
+                                                                                    \
+    static inline void Name##_Write(Name##_t* Lock, const Type* Value)              \
+    {                                                                               \
+        Lock->Sequence = Lock->Sequence + 1U;   /* Readers move to copy 1 */        \
+        CORE_DMB();                                                                 \
+        Lock->Copy[0] = *Value;                                                     \
+        CORE_DMB();                                                                 \
+        Lock->Sequence = Lock->Sequence + 1U;   /* Readers move back to copy 0 */   \
+        CORE_DMB();                                                                 \
+        Lock->Copy[1] = *Value;                                                     \
+    }                                                                               \
+                                                                                    \
+    static inline uint8_t Name##_Read(Name##_t* Lock, Type* Value)                  \
+    {                                                                               \
+        uint32_t Sequence = 0U;                                                     \
+        uint32_t Attempt = 0U;                                                      \
+                                                                                    \
+        for (Attempt = 0U; Attempt < SEQLOCK_MAX_RETRIES; Attempt++)                \
+        {                                                                           \
+            Sequence = Lock->Sequence;                                              \
+            CORE_DMB();                                                             \
+            *Value = Lock->Copy[Sequence & 1U];                                     \
+            CORE_DMB();                                                             \
+            if (Lock->Sequence == Sequence)                                         \
+            {                                                                       \
+                return OK;                                                          \
+            }                                                                       \
+        }                                                                           \
+                                                                                    \
+        return NOK;                                                                 \
+    }
+
+#endif /* SEQLOCK_INTERFACE_H */
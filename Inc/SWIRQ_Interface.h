@@ -0,0 +1,83 @@
+/**
+ * @file SWIRQ_Interface.h
+ * @brief Interface for the token-bucket admission of software-triggered interrupts.
+ *
+ * This file provides software IRQ lines guarded by a token bucket: each raise through
+ * STIR spends a token, and tokens come back at a fixed rate in CPU cycles up to a burst
+ * capacity. A post finding the IRQ already pending is merged into it for free. A post
+ * finding the bucket empty raises nothing: it is counted in Held, and the line is raised
+ * once for all held posts by the next admitted post or by SWIRQ_Tick(). A chatty producer
+ * is thus held to Capacity raises in a burst and one raise per RefillCycles after that,
+ * and the work below the line's priority keeps its share of the CPU.
+ *
+ * The handler calls SWIRQ_Take() to learn how many posts its run covers; the posted work
+ * itself stays in the producer's own queue or flags.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef SWIRQ_INTERFACE_H
+#define SWIRQ_INTERFACE_H
+
+#include <stdint.h>
+#include "NVIC_Interface.h"
+
+/**
+ * @struct SWIRQ_Line_t
+ * @brief One software IRQ line and its bucket.
+ */
+typedef struct
+{
+    IRQn_Type IRQn;
+    uint32_t Capacity;            /**< Burst size, in raises */
+    uint32_t RefillCycles;        /**< CPU cycles per token */
+    uint32_t Tokens;
+    uint32_t LastRefill;          /**< CYCCNT the bucket was last refilled at */
+    volatile uint32_t Held;       /**< Posts over budget, waiting for a token */
+    volatile uint32_t Posts;      /**< Posts not yet taken by the handler */
+    uint32_t Raised;              /**< STIR writes, statistic */
+    uint32_t Throttled;           /**< Posts ever held, statistic */
+} SWIRQ_Line_t;
+
+/**
+ * @brief Sets up a line on an IRQ with no peripheral in use, with a full bucket.
+ *
+ * Starts the DWT cycle counter, then gives the IRQ its priority and enables it.
+ *
+ * @param[out] Line          Line to set up.
+ * @param[in]  IRQn          Software IRQ.
+ * @param[in]  Priority      Priority of the IRQ, 0-15.
+ * @param[in]  Capacity      Burst size, at least 1.
+ * @param[in]  RefillCycles  CPU cycles per token, at least 1. Tokens accrue only across
+ *                           CYCCNT wrap periods (about 23 s at 180 MHz) if SWIRQ_Tick()
+ *                           or SWIRQ_Post() runs at least once per period.
+ * @return uint8_t OK, NOK on a zero Capacity or RefillCycles, NULL_PTR_ERR on a NULL pointer.
+ */
+uint8_t SWIRQ_Init(SWIRQ_Line_t* Line, IRQn_Type IRQn, uint32_t Priority, uint32_t Capacity, uint32_t RefillCycles);
+
+/**
+ * @brief Posts work to the line, raising its IRQ if the budget allows.
+ *
+ * @param[in,out] Line  Line to post to.
+ * @return uint8_t OK when the IRQ was raised or already pending, NOK when the post is held.
+ */
+uint8_t SWIRQ_Post(SWIRQ_Line_t* Line);
+
+/**
+ * @brief Raises the line for its held posts once a token is back; call periodically
+ *        (e.g. from SysTick) so held posts do not wait for the next post.
+ *
+ * @param[in,out] Line  Line to service.
+ */
+void SWIRQ_Tick(SWIRQ_Line_t* Line);
+
+/**
+ * @brief Called by the line's handler: takes the posts its run covers.
+ *
+ * @param[in,out] Line  Line being handled.
+ * @return uint32_t Posts made since the previous call, held ones excluded.
+ */
+uint32_t SWIRQ_Take(SWIRQ_Line_t* Line);
+
+#endif /* SWIRQ_INTERFACE_H */
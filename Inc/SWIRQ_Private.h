@@ -0,0 +1,6 @@
+#ifndef SWIRQ_PRIVATE_H
+#define SWIRQ_PRIVATE_H
+
+#define SWIRQ_STIR_INTID_MASK    0x1FFUL   /**< STIR INTID field */
+
+#endif /*SWIRQ_PRIVATE_H*/
@@ -0,0 +1,77 @@
+/**
+ * @file TRACEENC_Interface.h
+ * @brief Interface for the compressed encoder of the ISR trace stream.
+ *
+ * This file provides an encoder that turns the records of the ISR trace (TRACE_Program.c)
+ * into a compact byte stream for a USART, and the stream format shared with the host
+ * decoder (Tools/TraceDecode.c). Encoding is incremental: each call stops at a cycle
+ * budget or when the output space runs out, so it can run inside a low-priority drain IRQ.
+ *
+ * Stream format, one token per trace record:
+ *   - Token byte: bits 7:2 time delta (0-62, 63 = escape), bit 1 PREDICTED, bit 0 EXIT.
+ *   - Escape: a varint V follows (7 bits per byte, least significant first). V below
+ *     TRACEENC_CTRL_CODES is a control code, otherwise the delta is V - TRACEENC_CTRL_CODES + 63.
+ *   - IRQ byte: only when PREDICTED is clear. The predicted IRQ of an exit is the innermost
+ *     running handler, that of an entry the IRQ of the previous entry, so exits and
+ *     back-to-back entries of the same IRQ cost no identifier byte.
+ *   - The delta is counted in units of 2^Shift cycles. Both sides advance their clock by
+ *     Delta << Shift, so the rounding error never accumulates. A record stamped before
+ *     the clock is sent with a zero delta. A gap of more than 2^31 cycles between two
+ *     records (about 12 s at 180 MHz) reads as such a record.
+ * Control codes (token byte 0xFC):
+ *   - SYNC: Shift byte and 32-bit little-endian timestamp; clears the nesting state.
+ *     Starts the stream and follows every overrun.
+ *   - OVERRUN: varint count of records lost because the trace ring wrapped.
+ *
+ * A short handler at high interrupt rate, the case that saturates the link, costs one
+ * byte per record against eight for the raw TRACE_Record_t.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef TRACEENC_INTERFACE_H
+#define TRACEENC_INTERFACE_H
+
+#include <stdint.h>
+
+#define TRACEENC_DELTA_ESCAPE      63U     /**< Token delta field value announcing a varint */
+#define TRACEENC_FLAG_PREDICTED    0x02U   /**< Token bit: IRQ is the predicted one, no IRQ byte */
+#define TRACEENC_FLAG_EXIT         0x01U   /**< Token bit: handler exit, entry when clear */
+#define TRACEENC_CTRL_TOKEN        (TRACEENC_DELTA_ESCAPE << 2)   /**< Token byte of a control code */
+#define TRACEENC_CTRL_SYNC         0U      /**< Control code: shift and absolute timestamp follow */
+#define TRACEENC_CTRL_OVERRUN      1U      /**< Control code: lost record count follows */
+#define TRACEENC_CTRL_CODES        4U      /**< Varint values reserved for control codes */
+#define TRACEENC_MAX_DEPTH         16U     /**< Tracked nesting depth, one handler per priority level */
+#define TRACEENC_MAX_SHIFT         16U     /**< Coarsest timestamp unit, 2^16 cycles */
+#define TRACEENC_MAX_TOKEN         8U      /**< Largest token in bytes, rounded up */
+
+/**
+ * @brief Starts encoding from the current end of the trace.
+ *
+ * @param[in] Shift  Timestamp unit is 2^Shift CPU cycles, 0 to TRACEENC_MAX_SHIFT.
+ * @return uint8_t OK on success, NOK when the trace is not initialised or Shift is too large.
+ */
+uint8_t TRACEENC_Init(uint8_t Shift);
+
+/**
+ * @brief Encodes pending trace records into a buffer, within a cycle budget.
+ *
+ * A record is never split across calls: encoding stops before a token that might not
+ * fit. The budget is checked before each record, so a call overruns it by one record at most.
+ *
+ * @param[out] Out          Output buffer.
+ * @param[in]  Space        Bytes available in Out, at least TRACEENC_MAX_TOKEN for progress.
+ * @param[in]  CycleBudget  CPU cycles the call may spend.
+ * @return uint32_t Bytes written to Out.
+ */
+uint32_t TRACEENC_Encode(uint8_t* Out, uint32_t Space, uint32_t CycleBudget);
+
+/**
+ * @brief Returns the number of trace records not encoded yet.
+ *
+ * @return uint32_t Pending records, more than the ring holds after an overrun.
+ */
+uint32_t TRACEENC_Backlog(void);
+
+#endif /* TRACEENC_INTERFACE_H */
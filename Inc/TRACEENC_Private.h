@@ -0,0 +1,22 @@
+#ifndef TRACEENC_PRIVATE_H
+#define TRACEENC_PRIVATE_H
+
+#define TRACEENC_NO_IRQ      0xFFU    /**< No prediction available */
+
+/**
+ * @struct TRACEENC_State_t
+ * @brief Encoder state, mirrored by the decoder.
+ */
+typedef struct
+{
+    uint32_t Tail;                          /**< Trace records consumed */
+    uint32_t Clock;                         /**< Timestamp as known by the decoder */
+    uint8_t  Shift;                         /**< Timestamp unit, 2^Shift cycles */
+    uint8_t  NeedSync;                      /**< A SYNC token is due */
+    uint8_t  Depth;                         /**< Running handlers */
+    uint8_t  LastEnter;                     /**< IRQ of the previous entry */
+    uint8_t  Stack[TRACEENC_MAX_DEPTH];     /**< Running handlers, innermost last */
+    uint32_t Lost;                          /**< Records lost to an overrun, not reported yet */
+} TRACEENC_State_t;
+
+#endif /*TRACEENC_PRIVATE_H*/
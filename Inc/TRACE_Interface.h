@@ -0,0 +1,142 @@
+/**
+ * @file TRACE_Interface.h
+ * @brief Interface for the ISR trace and per-IRQ timing statistics.
+ *
+ * This file provides the function declarations required to record ISR entry/exit events
+ * in a ring buffer and to accumulate per-IRQ inclusive execution times. The buffer can live in
+ * ordinary RAM or in the 4 KB backup SRAM, where it survives resets: at boot a fast
+ * header check decides whether the previous run's trace is kept for recovery.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef TRACE_INTERFACE_H
+#define TRACE_INTERFACE_H
+
+#include <stdint.h>
+#include "NVIC_Interface.h"
+
+#define TRACE_RECORD_COUNT    256U     /**< Ring buffer depth, a power of two */
+
+/**
+ * @enum TRACE_Location_t
+ * @brief Memory holding the trace buffer.
+ */
+typedef enum
+{
+    TRACE_IN_SRAM = 0U,          /**< Main SRAM (.noinit): survives software and watchdog resets */
+    TRACE_IN_BACKUP_SRAM         /**< Backup SRAM: survives every reset, Standby and VBAT mode (backup regulator on) */
+} TRACE_Location_t;
+
+/**
+ * @enum TRACE_Event_t
+ * @brief Kind of a trace record.
+ */
+typedef enum
+{
+    TRACE_ISR_ENTER = 0U,
+    TRACE_ISR_EXIT  = 1U
+} TRACE_Event_t;
+
+/**
+ * @struct TRACE_Record_t
+ * @brief One trace event.
+ */
+typedef struct
+{
+    uint32_t Timestamp;   /**< DWT cycle counter */
+    uint8_t  IRQn;        /**< Interrupt number */
+    uint8_t  Event;       /**< TRACE_Event_t */
+    uint8_t  Depth;       /**< Nesting depth of traced handlers, 1 for the outermost */
+    uint8_t  Reserved;
+} TRACE_Record_t;
+
+/**
+ * @struct TRACE_IsrStats_t
+ * @brief Inclusive execution time statistics of one IRQ, in CPU cycles.
+ *
+ * Each execution is timed from TRACE_IsrEnter() to TRACE_IsrExit(), so the time of any
+ * handler that preempted it is included. This is not interrupt latency, the delay from
+ * pending to entry: CALIB_Run() measures that one.
+ */
+typedef struct
+{
+    uint32_t Count;                 /**< Completed executions */
+    uint32_t InclusiveCycles;       /**< Sum of the inclusive execution times */
+    uint32_t MaxInclusiveCycles;    /**< Longest inclusive execution time */
+} TRACE_IsrStats_t;
+
+/**
+ * @struct TRACE_Buffer_t
+ * @brief Trace storage, laid out to fit the backup SRAM.
+ */
+typedef struct
+{
+    uint32_t         Magic;                        /**< TRACE_MAGIC in an initialised buffer */
+    uint32_t         Layout;                       /**< Size and geometry signature of this build */
+    uint32_t         HeaderCheck;                  /**< Check word over Magic and Layout */
+    volatile uint32_t Head;                        /**< Records written since the buffer was cleared */
+    TRACE_IsrStats_t Stats[NVIC_IRQ_COUNT];        /**< Per-IRQ inclusive execution time statistics */
+    TRACE_Record_t   Records[TRACE_RECORD_COUNT];  /**< Event ring, oldest entry at Head % TRACE_RECORD_COUNT once full */
+} TRACE_Buffer_t;
+
+/**
+ * @brief Byte sink used to stream a recovered trace (e.g. a polled USART write).
+ *
+ * @param[in] Data    Bytes to send.
+ * @param[in] Length  Number of bytes.
+ */
+typedef void (*TRACE_Write_t)(const uint8_t* Data, uint32_t Length);
+
+/**
+ * @brief Selects the trace memory and validates what it holds.
+ *
+ * When the buffer holds a valid trace from the previous run, it is kept and recording
+ * stays paused until TRACE_StreamPrevious() or TRACE_Discard() is called; otherwise the
+ * buffer is cleared and recording starts. For the backup SRAM it also turns the backup
+ * regulator on (PWR_CSR.BRE) and waits, bounded, for it to be ready.
+ *
+ * @param[in] Location  Memory holding the trace buffer.
+ * @return uint8_t 1 when a previous trace was found, 0 otherwise.
+ */
+uint8_t TRACE_Init(TRACE_Location_t Location);
+
+/**
+ * @brief Streams the previous run's trace, then clears it and starts recording.
+ *
+ * The stream is the raw TRACE_Buffer_t image, with records rotated so that the oldest
+ * comes first and Head rewritten to the number of records sent.
+ *
+ * @param[in] Write  Byte sink.
+ * @return uint32_t Number of bytes streamed, 0 when there was nothing to recover.
+ */
+uint32_t TRACE_StreamPrevious(TRACE_Write_t Write);
+
+/**
+ * @brief Drops the previous run's trace and starts recording.
+ */
+void TRACE_Discard(void);
+
+/**
+ * @brief Records the entry of an interrupt handler; call it first thing in the handler.
+ *
+ * @param[in] IRQn  Interrupt being served.
+ */
+void TRACE_IsrEnter(IRQn_Type IRQn);
+
+/**
+ * @brief Records the exit of an interrupt handler; call it last thing in the handler.
+ *
+ * @param[in] IRQn  Interrupt being served.
+ */
+void TRACE_IsrExit(IRQn_Type IRQn);
+
+/**
+ * @brief Returns the trace buffer, for on-target inspection.
+ *
+ * @return const TRACE_Buffer_t* The active buffer, or NULL before TRACE_Init().
+ */
+const TRACE_Buffer_t* TRACE_GetBuffer(void);
+
+#endif /* TRACE_INTERFACE_H */
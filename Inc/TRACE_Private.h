@@ -0,0 +1,28 @@
+#ifndef TRACE_PRIVATE_H
+#define TRACE_PRIVATE_H
+
+#define TRACE_MAGIC               0x54524143UL   /**< "TRAC" */
+#define TRACE_LAYOUT              (((uint32_t)sizeof(TRACE_Buffer_t) << 16) | (NVIC_IRQ_COUNT << 8) | 1U) /**< Size, IRQ count, format version */
+#define TRACE_HEADER_CHECK(Magic, Layout)   ((uint32_t)~((uint32_t)(Magic) ^ (uint32_t)((Layout) * 0x9E3779B1UL)))
+
+#define TRACE_RETAINED            __attribute__((section(".noinit")))   /**< RAM left untouched by the startup code */
+
+/* RCC and PWR bits needed to reach the backup SRAM */
+#define TRACE_RCC_APB1ENR_PWREN      28U
+#define TRACE_RCC_AHB1ENR_BKPSRAMEN  18U
+#define TRACE_PWR_CR_DBP             8U
+
+#define TRACE_BRR_TIMEOUT            100000UL   /**< BRR polls before giving up on the backup regulator */
+
+/**
+ * @enum TRACE_State_t
+ * @brief Recording state.
+ */
+typedef enum
+{
+    TRACE_STATE_OFF = 0U,        /**< TRACE_Init() not called */
+    TRACE_STATE_HELD,            /**< Previous run's trace kept, recording paused */
+    TRACE_STATE_RECORDING        /**< Events are recorded */
+} TRACE_State_t;
+
+#endif /*TRACE_PRIVATE_H*/
@@ -0,0 +1,131 @@
+/**
+ * @file USARTTX_Interface.h
+ * @brief Interface for the scatter-gather DMA transmit engine of USART1/2/3/6.
+ *
+ * This file provides a transmit queue of {address, length} records sent by DMA straight
+ * from the caller's memory, without copying them into a staging buffer. Records are
+ * queued as chains, for instance the records of one telemetry frame, and the completion
+ * callback runs once per chain, when the DMA has read its last byte and its buffers may
+ * be reused.
+ *
+ * The STM32F4 DMA has no linked descriptors: the transfer complete interrupt re-arms the
+ * stream with the next record, so there is one DMA interrupt per transfer and none per
+ * byte. Records of a chain that are adjacent in memory are sent as one transfer.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef USARTTX_INTERFACE_H
+#define USARTTX_INTERFACE_H
+
+#include <stdint.h>
+#include "NVIC_Interface.h"
+
+/**
+ * @enum USARTTX_Port_t
+ * @brief USART and the DMA stream serving its transmitter.
+ */
+typedef enum
+{
+    USARTTX_PORT_1 = 0U,   /**< USART1, DMA2 stream 7 channel 4 */
+    USARTTX_PORT_2,        /**< USART2, DMA1 stream 6 channel 4 */
+    USARTTX_PORT_3,        /**< USART3, DMA1 stream 3 channel 4 */
+    USARTTX_PORT_6,        /**< USART6, DMA2 stream 6 channel 5 */
+    USARTTX_PORT_COUNT
+} USARTTX_Port_t;
+
+/**
+ * @struct USARTTX_Record_t
+ * @brief One piece of a chain, sent in place.
+ */
+typedef struct
+{
+    const void* Data;
+    uint16_t Length;       /**< Bytes, at least 1 */
+} USARTTX_Record_t;
+
+/**
+ * @brief Chain completion callback, run in the DMA interrupt.
+ */
+typedef void (*USARTTX_Done_t)(void* ChainContext);
+
+/**
+ * @struct USARTTX_Slot_t
+ * @brief Queued record; storage provided by the caller.
+ */
+typedef struct
+{
+    uint32_t Address;
+    uint16_t Length;
+    uint8_t EndOfChain;
+    void* ChainContext;    /**< Set on the last record of a chain */
+} USARTTX_Slot_t;
+
+/**
+ * @struct USARTTX_Config_t
+ * @brief Configuration of a transmit engine.
+ */
+typedef struct
+{
+    USARTTX_Port_t Port;
+    uint32_t Brr;          /**< BRR value for the baud rate at the port's bus clock */
+    USARTTX_Slot_t* Slots;
+    uint16_t SlotCount;    /**< Power of two */
+    uint8_t DmaPriority;   /**< NVIC priority of the DMA stream interrupt */
+    USARTTX_Done_t Done;   /**< May be NULL */
+} USARTTX_Config_t;
+
+/**
+ * @struct USARTTX_Handle_t
+ * @brief Run-time state of an engine, owned by the driver.
+ */
+typedef struct
+{
+    USARTTX_Config_t Config;       /**< Copy of the configuration */
+    volatile uint16_t Head;        /**< Next slot written by USARTTX_Send() */
+    volatile uint16_t Tail;        /**< First slot not yet sent */
+    uint16_t InFlight;             /**< Slots covered by the running transfer */
+    volatile uint8_t Busy;         /**< 1 while a transfer runs */
+    uint32_t Transfers;            /**< DMA transfers started, statistic */
+    uint32_t Chains;               /**< Chains completed, statistic */
+    uint32_t Errors;               /**< Transfers ended by a DMA error, statistic */
+} USARTTX_Handle_t;
+
+/**
+ * @brief Configures the USART transmitter, its DMA stream and the DMA interrupt.
+ *
+ * The USART pins must already be configured. The vector of the port's DMA stream must
+ * call USARTTX_DmaIRQHandler() with the handle.
+ *
+ * @param[out] Handle  Engine state.
+ * @param[in]  Config  Engine configuration.
+ * @return uint8_t OK, NOK on an invalid port or slot count, NULL_PTR_ERR on a NULL pointer.
+ */
+uint8_t USARTTX_Init(USARTTX_Handle_t* Handle, const USARTTX_Config_t* Config);
+
+/**
+ * @brief Queues a chain of records; callable from any priority.
+ *
+ * The records' memory must stay unchanged until the chain's completion callback.
+ *
+ * @param[in,out] Handle        Engine state.
+ * @param[in]     Records       Count records, sent in order.
+ * @param[in]     Count         Records in the chain, at least 1.
+ * @param[in]     ChainContext  Passed to the completion callback.
+ * @return uint8_t OK, NOK when the queue cannot take the whole chain or a record is empty,
+ *                 NULL_PTR_ERR on a NULL pointer.
+ */
+uint8_t USARTTX_Send(USARTTX_Handle_t* Handle, const USARTTX_Record_t* Records, uint16_t Count, void* ChainContext);
+
+/**
+ * @brief DMA stream handler, call it from the vector of the port's DMA stream.
+ *
+ * A transfer ended by a DMA error is counted and treated as sent, so its chain still
+ * completes and its buffers are released.
+ *
+ * @param[in,out] Handle  Engine state.
+ */
+void USARTTX_DmaIRQHandler(USARTTX_Handle_t* Handle);
+
+#endif /* USARTTX_INTERFACE_H */
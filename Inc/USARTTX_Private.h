@@ -0,0 +1,37 @@
+#ifndef USARTTX_PRIVATE_H
+#define USARTTX_PRIVATE_H
+
+#include "../../../LIB/STM32F446xx.h"
+
+/**
+ * @struct USARTTX_PortDef_t
+ * @brief Registers, clocks and DMA routing of a port.
+ */
+typedef struct
+{
+    USART_RegDef_t* Usart;
+    DMA_RegDef_t* Dma;
+    uint8_t Stream;
+    uint8_t Channel;
+    IRQn_Type DmaIRQ;
+    uint8_t Apb2;               /**< 1 when the USART clock is on APB2, 0 on APB1 */
+    uint8_t UsartEnBit;         /**< Enable bit in APB1ENR or APB2ENR */
+    uint8_t DmaEnBit;           /**< Enable bit in AHB1ENR */
+} USARTTX_PortDef_t;
+
+/* RCC enable bits */
+#define USARTTX_RCC_APB2ENR_USART1EN    4U
+#define USARTTX_RCC_APB2ENR_USART6EN    5U
+#define USARTTX_RCC_APB1ENR_USART2EN    17U
+#define USARTTX_RCC_APB1ENR_USART3EN    18U
+#define USARTTX_RCC_AHB1ENR_DMA1EN      21U
+#define USARTTX_RCC_AHB1ENR_DMA2EN      22U
+
+/* USART register bit positions */
+#define USARTTX_CR1_TE                  3U
+#define USARTTX_CR1_UE                  13U
+#define USARTTX_CR3_DMAT                7U
+
+#define USARTTX_MAX_TRANSFER            0xFFFFUL   /**< NDTR limit */
+
+#endif /*USARTTX_PRIVATE_H*/
@@ -0,0 +1,26 @@
+/**
+ * @file VECTOR_Config.h
+ * @brief Handler bindings of the application, compiled into the vector table.
+ *
+ * Bind a handler to a slot with #define VECTOR_BIND_<Slot> VECTOR_BOUND(Handler); every
+ * other slot runs VECTOR_DefaultHandler(). Slots are the IRQn_Type names for the IRQs and
+ * NMI, HardFault, MemManage, BusFault, UsageFault, SVCall, DebugMon, PendSV and SysTick
+ * for the core exceptions. A second binding of the same slot is a macro redefinition,
+ * which the compiler reports; reserved slots have no name and cannot be bound.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef VECTOR_CONFIG_H
+#define VECTOR_CONFIG_H
+
+/* Core exception bindings, e.g. #define VECTOR_BIND_SysTick VECTOR_BOUND(SysTick_Handler) */
+#define VECTOR_BIND_HardFault       VECTOR_BOUND(HardFault_Handler)
+#define VECTOR_BIND_MemManage       VECTOR_BOUND(MemManage_Handler)
+#define VECTOR_BIND_BusFault        VECTOR_BOUND(BusFault_Handler)
+#define VECTOR_BIND_UsageFault      VECTOR_BOUND(UsageFault_Handler)
+
+/* IRQ bindings, e.g. #define VECTOR_BIND_TIM2 VECTOR_BOUND(TIM2_IRQHandler) */
+
+#endif /* VECTOR_CONFIG_H */
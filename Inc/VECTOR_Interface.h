@@ -0,0 +1,65 @@
+/**
+ * @file VECTOR_Interface.h
+ * @brief Interface for the vector table generated from the handler bindings.
+ *
+ * This file provides a const vector table placed in flash (.isr_vector), built at compile
+ * time from the bindings listed in VECTOR_Config.h. Unbound slots share one default
+ * handler, so no weak alias per handler is needed and nothing is copied to RAM. Every
+ * slot is generated in order from one list; static assertions check that list against
+ * the 97 IRQ slots of the STM32F446xx reference manual and each name against IRQn_Type.
+ *
+ * Link this file instead of the table of an assembly startup file. The linker script
+ * provides _estack and the application provides Reset_Handler().
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef VECTOR_INTERFACE_H
+#define VECTOR_INTERFACE_H
+
+#include <stdint.h>
+#include "NVIC_Interface.h"
+
+/* Core exception numbers: vector table slots below the IRQs */
+#define VECTOR_NMI            2U
+#define VECTOR_HARDFAULT      3U
+#define VECTOR_MEMMANAGE      4U
+#define VECTOR_BUSFAULT       5U
+#define VECTOR_USAGEFAULT     6U
+#define VECTOR_SVCALL         11U
+#define VECTOR_DEBUGMON       12U
+#define VECTOR_PENDSV         14U
+#define VECTOR_SYSTICK        15U
+
+#define VECTOR_IRQ_BASE       16U                                  /**< Slot of IRQ 0 */
+#define VECTOR_SIZE           (VECTOR_IRQ_BASE + NVIC_IRQ_COUNT)   /**< Slots in the table */
+
+/**
+ * @brief Value of a VECTOR_BIND_<Slot> binding in VECTOR_Config.h.
+ */
+#define VECTOR_BOUND(Handler) ~, Handler
+
+/**
+ * @brief Exception handler.
+ */
+typedef void (*VECTOR_Handler_t)(void);
+
+/**
+ * @union VECTOR_Entry_t
+ * @brief Vector table slot: the initial stack pointer in slot 0, a handler elsewhere.
+ */
+typedef union
+{
+    void* Stack;
+    VECTOR_Handler_t Handler;
+} VECTOR_Entry_t;
+
+extern const VECTOR_Entry_t VECTOR_Table[VECTOR_SIZE];
+
+/**
+ * @brief Handler of every unbound slot: keeps the exception number for the debugger and halts.
+ */
+void VECTOR_DefaultHandler(void);
+
+#endif /* VECTOR_INTERFACE_H */
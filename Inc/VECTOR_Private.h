@@ -0,0 +1,57 @@
+#ifndef VECTOR_PRIVATE_H
+#define VECTOR_PRIVATE_H
+
+#define VECTOR_RM_IRQ_SLOTS         97U    /* IRQ slots of the STM32F446xx vector table (RM0390, table 38) */
+
+/* Core slots 2 to 15 in table order: CORE(Name) holds a handler, RESERVED(Slot) holds 0 */
+#define VECTOR_CORE_SLOTS(CORE, RESERVED)                                                      \
+    CORE(NMI) CORE(HardFault) CORE(MemManage) CORE(BusFault) CORE(UsageFault)                 \
+    RESERVED(7) RESERVED(8) RESERVED(9) RESERVED(10) CORE(SVCall) CORE(DebugMon) RESERVED(13) \
+    CORE(PendSV) CORE(SysTick)
+
+/* IRQ slots 0 to 96 in table order: IRQ(IRQn_Type name), RESERVED(IRQn) for slots with no peripheral */
+#define VECTOR_IRQ_SLOTS(IRQ, RESERVED)                                                        \
+    IRQ(WWDG) IRQ(PVD) IRQ(TAMP_STAMP) IRQ(RTC_WKUP) IRQ(FLASH) IRQ(RCC)                       \
+    IRQ(EXTI0) IRQ(EXTI1) IRQ(EXTI2) IRQ(EXTI3) IRQ(EXTI4)                                     \
+    IRQ(DMA1_Stream0) IRQ(DMA1_Stream1) IRQ(DMA1_Stream2) IRQ(DMA1_Stream3)                    \
+    IRQ(DMA1_Stream4) IRQ(DMA1_Stream5) IRQ(DMA1_Stream6) IRQ(ADC)                             \
+    IRQ(CAN1_TX) IRQ(CAN1_RX0) IRQ(CAN1_RX1) IRQ(CAN1_SCE) IRQ(EXTI9_5)                        \
+    IRQ(TIM1_BRK_TIM9) IRQ(TIM1_UP_TIM10) IRQ(TIM1_TRG_COM_TIM11) IRQ(TIM1_CC)                 \
+    IRQ(TIM2) IRQ(TIM3) IRQ(TIM4) IRQ(I2C1_EV) IRQ(I2C1_ER) IRQ(I2C2_EV) IRQ(I2C2_ER)          \
+    IRQ(SPI1) IRQ(SPI2) IRQ(USART1) IRQ(USART2) IRQ(USART3) IRQ(EXTI5_10)                      \
+    IRQ(RTC_Alarm) IRQ(OTG_FS_WKUP) IRQ(TIM8_BRK_TIM12) IRQ(TIM8_UP_TIM13)                     \
+    IRQ(TIM8_TRG_COM_TIM14) IRQ(TIM8_CC) IRQ(DMA1_Stream7) IRQ(FMC) IRQ(SDIO)                  \
+    IRQ(TIM5) IRQ(SPI3) IRQ(UART4) IRQ(UART5) IRQ(TIM6_DAC) IRQ(TIM7)                          \
+    IRQ(DMA2_Stream0) IRQ(DMA2_Stream1) IRQ(DMA2_Stream2) IRQ(DMA2_Stream3)                    \
+    IRQ(DMA2_Stream4) RESERVED(61) RESERVED(62)                                                \
+    IRQ(CAN2_TX) IRQ(CAN2_RX0) IRQ(CAN2_RX1) IRQ(CAN2_SCE) IRQ(OTG_FS)                         \
+    IRQ(DMA2_Stream5) IRQ(DMA2_Stream6) IRQ(DMA2_Stream7) IRQ(USART6)                          \
+    IRQ(I2C3_EV) IRQ(I2C3_ER) IRQ(OTG_HS_EP1_OUT) IRQ(OTG_HS_EP1_IN) IRQ(OTG_HS_WKUP)          \
+    IRQ(OTG_HS) IRQ(DCMI) RESERVED(79) RESERVED(80) IRQ(FPU) RESERVED(82) RESERVED(83)         \
+    IRQ(SPI4) RESERVED(85) RESERVED(86) IRQ(SAI1) RESERVED(88) RESERVED(89) RESERVED(90)       \
+    IRQ(SAI2) IRQ(QuadSPI) IRQ(HDMI_CEC) IRQ(SPDIF_Rx) IRQ(FMPI2C1) IRQ(FMPI2C1_error)
+
+/* Handler of a named slot: its VECTOR_BIND_ binding, VECTOR_DefaultHandler when it has none */
+#define VECTOR_HANDLER(Slot)                 VECTOR_SECOND(VECTOR_BIND_##Slot, VECTOR_DefaultHandler, ~)
+#define VECTOR_SECOND(...)                   VECTOR_SECOND_(__VA_ARGS__)
+#define VECTOR_SECOND_(First, Second, ...)   Second
+
+/* Expansions of the slot lists */
+#define VECTOR_DECLARE(Slot)                 void VECTOR_HANDLER(Slot)(void);
+#define VECTOR_NO_DECLARE(Slot)
+#define VECTOR_ENTRY(Slot)                   { .Handler = VECTOR_HANDLER(Slot) },
+#define VECTOR_CORE_RESERVED_ENTRY(Slot)     { .Handler = 0 },
+#define VECTOR_IRQ_RESERVED_ENTRY(IRQn)      { .Handler = VECTOR_DefaultHandler },
+#define VECTOR_CORE_POSITION(Slot)           VECTOR_CorePosition_##Slot,
+#define VECTOR_CORE_RESERVED_POSITION(Slot)  VECTOR_CorePosition_Reserved##Slot,
+#define VECTOR_IRQ_POSITION(IRQn)            VECTOR_IrqPosition_##IRQn,
+#define VECTOR_IRQ_RESERVED_POSITION(IRQn)   VECTOR_IrqPosition_Reserved##IRQn,
+#define VECTOR_CHECK_POSITION(IRQn)          _Static_assert((uint32_t)VECTOR_IrqPosition_##IRQn == (uint32_t)(IRQn), \
+                                                            #IRQn " is out of place in VECTOR_IRQ_SLOTS");
+#define VECTOR_CHECK_RESERVED(IRQn)          _Static_assert((uint32_t)VECTOR_IrqPosition_Reserved##IRQn == (IRQn), \
+                                                            "Reserved IRQ " #IRQn " is out of place in VECTOR_IRQ_SLOTS");
+#define VECTOR_CHECK_CORE_RESERVED(Slot)     _Static_assert((uint32_t)VECTOR_CorePosition_Reserved##Slot == (Slot), \
+                                                            "Reserved slot " #Slot " is out of place in VECTOR_CORE_SLOTS");
+#define VECTOR_NO_CHECK(Slot)
+
+#endif /*VECTOR_PRIVATE_H*/
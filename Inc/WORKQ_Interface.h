@@ -0,0 +1,77 @@
+/**
+ * @file WORKQ_Interface.h
+ * @brief Interface for the deduplicating work bitmap served by a software IRQ.
+ *
+ * This file provides work queues of up to 32 fixed work items, each one a bit in a word.
+ * Posting an item sets its bit atomically and pends the queue's IRQ only when the word
+ * goes from zero to non-zero, so any number of posts of the same item, from any number of
+ * producers, cost one run of its function and one NVIC write until the IRQ takes them.
+ * The IRQ takes the whole word in one atomic swap and runs the set items, highest
+ * item number first.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef WORKQ_INTERFACE_H
+#define WORKQ_INTERFACE_H
+
+#include <stdint.h>
+#include "NVIC_Interface.h"
+
+#define WORKQ_MAX_ITEMS    32U
+
+/**
+ * @brief Work item function, run in the queue's IRQ.
+ */
+typedef void (*WORKQ_Work_t)(uint8_t Item, void* Context);
+
+/**
+ * @struct WORKQ_Queue_t
+ * @brief One work bitmap and its IRQ.
+ */
+typedef struct
+{
+    volatile uint32_t Pending;            /**< Bit n set while item n is posted and not yet run */
+    const WORKQ_Work_t* Works;            /**< Function per item */
+    void* Context;
+    uint8_t ItemCount;
+    IRQn_Type IRQn;
+} WORKQ_Queue_t;
+
+/**
+ * @brief Sets up a queue on an IRQ with no peripheral in use.
+ *
+ * Gives the IRQ its priority and enables it. The IRQ's vector must call WORKQ_Dispatch()
+ * with the queue.
+ *
+ * @param[out] Queue      Queue to set up.
+ * @param[in]  Works      ItemCount functions, kept by pointer.
+ * @param[in]  ItemCount  Number of items, 1 to WORKQ_MAX_ITEMS.
+ * @param[in]  Context    Passed to every function.
+ * @param[in]  IRQn       Software IRQ.
+ * @param[in]  Priority   Priority of the IRQ, 0-15.
+ * @return uint8_t OK, NOK on an invalid ItemCount, NULL_PTR_ERR on a NULL pointer.
+ */
+uint8_t WORKQ_Init(WORKQ_Queue_t* Queue, const WORKQ_Work_t* Works, uint8_t ItemCount, void* Context, IRQn_Type IRQn,
+                   uint32_t Priority);
+
+/**
+ * @brief Posts a work item; callable from any priority, lock-free.
+ *
+ * @param[in,out] Queue  Queue to post to.
+ * @param[in]     Item   Item number.
+ * @return uint8_t OK, NOK on an invalid item.
+ */
+uint8_t WORKQ_Post(WORKQ_Queue_t* Queue, uint8_t Item);
+
+/**
+ * @brief Queue IRQ handler: runs every posted item once.
+ *
+ * An item posted again while it runs is run again on the next IRQ.
+ *
+ * @param[in] Queue  WORKQ_Queue_t to serve, typed void* for use as an IRQHT handler.
+ */
+void WORKQ_Dispatch(void* Queue);
+
+#endif /* WORKQ_INTERFACE_H */
@@ -0,0 +1,91 @@
+/**
+ * @file WWDG_Interface.h
+ * @brief Interface for the window watchdog driver with a pre-reset NVIC snapshot.
+ *
+ * This file provides the function declarations required to run the window watchdog
+ * and to read back, after the reset it caused, the NVIC state captured by its
+ * early wakeup interrupt. The early wakeup interrupt runs at NVIC priority 0 so that
+ * it preempts whichever handler starved the watchdog refresh.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#ifndef WWDG_INTERFACE_H
+#define WWDG_INTERFACE_H
+
+#include <stdint.h>
+#include "NVIC_Interface.h"
+
+#define WWDG_MAX_LOAD_COUNTERS    NVIC_IRQ_COUNT   /**< One load counter per IRQ at most */
+
+/**
+ * @struct WWDG_Config_t
+ * @brief Configuration of the window watchdog.
+ */
+typedef struct
+{
+    uint8_t Prescaler;   /**< WDGTB value 0-3, counter clock = PCLK1 / 4096 / 2^Prescaler */
+    uint8_t Window;      /**< Window value 0x40-0x7F, refreshing above it resets */
+    uint8_t Counter;     /**< Reload value 0x41-0x7F, reset occurs when it drops below 0x40 */
+} WWDG_Config_t;
+
+/**
+ * @struct WWDG_Snapshot_t
+ * @brief NVIC state saved by the early wakeup interrupt, kept across the reset.
+ */
+typedef struct
+{
+    uint32_t Magic;                                   /**< WWDG_SNAPSHOT_MAGIC when the record is complete */
+    uint32_t Timestamp;                               /**< DWT cycle counter at capture */
+    uint32_t Enabled[NVIC_IRQ_WORDS];                 /**< NVIC ISER words */
+    uint32_t Pending[NVIC_IRQ_WORDS];                 /**< NVIC ISPR words */
+    uint32_t Active[NVIC_IRQ_WORDS];                  /**< NVIC IABR words, the interrupts on the stack */
+    uint32_t LoadCount;                               /**< Valid entries of Load */
+    uint32_t Load[WWDG_MAX_LOAD_COUNTERS];            /**< Copy of the registered per-IRQ load counters */
+    uint32_t Checksum;                                /**< Checksum of every word above */
+} WWDG_Snapshot_t;
+
+/**
+ * @brief Starts the window watchdog with its early wakeup interrupt.
+ *
+ * The watchdog cannot be stopped once started; the early wakeup interrupt is given
+ * priority 0 and enabled.
+ *
+ * @param[in] Config  Watchdog configuration.
+ * @return uint8_t OK on success, NULL_PTR_ERR or NOK on invalid arguments.
+ */
+uint8_t WWDG_Init(const WWDG_Config_t* Config);
+
+/**
+ * @brief Reloads the watchdog counter; call it inside the configured window.
+ */
+void WWDG_Refresh(void);
+
+/**
+ * @brief Registers the per-IRQ load counters copied into the snapshot.
+ *
+ * @param[in] Counters  Array of counters maintained by the application, indexed by IRQn.
+ * @param[in] Count     Number of counters, at most WWDG_MAX_LOAD_COUNTERS.
+ */
+void WWDG_RegisterLoadCounters(const volatile uint32_t* Counters, uint32_t Count);
+
+/**
+ * @brief Retrieves the snapshot left by the previous run.
+ *
+ * @param[out] Snapshot  Copy of the snapshot.
+ * @return uint8_t OK when the last reset came from the watchdog and the snapshot is intact, NOK otherwise.
+ */
+uint8_t WWDG_GetSnapshot(WWDG_Snapshot_t* Snapshot);
+
+/**
+ * @brief Invalidates the retained snapshot and clears the reset flags.
+ */
+void WWDG_ClearSnapshot(void);
+
+/**
+ * @brief Early wakeup interrupt handler, captures the snapshot before the reset.
+ */
+void WWDG_IRQHandler(void);
+
+#endif /* WWDG_INTERFACE_H */
@@ -0,0 +1,27 @@
+#ifndef WWDG_PRIVATE_H
+#define WWDG_PRIVATE_H
+
+#define WWDG_SNAPSHOT_MAGIC       0x57574447UL   /**< "WWDG" */
+
+#define WWDG_RETAINED             __attribute__((section(".noinit")))   /**< RAM left untouched by the startup code */
+
+#define WWDG_EARLY_PRIORITY       0U             /**< Top priority, preempts the handler that starved the refresh */
+
+/* RCC bits */
+#define WWDG_RCC_APB1ENR_WWDGEN   11U
+#define WWDG_RCC_CSR_RMVF         24U
+#define WWDG_RCC_CSR_WWDGRSTF     30U
+
+/* CR register */
+#define WWDG_CR_WDGA              7U
+#define WWDG_COUNTER_MASK         0x7FU
+#define WWDG_COUNTER_MIN          0x40U
+
+/* CFR register */
+#define WWDG_CFR_WDGTB            7U             /**< 2 bits */
+#define WWDG_CFR_EWI              9U
+
+/* SR register */
+#define WWDG_SR_EWIF              0U
+
+#endif /*WWDG_PRIVATE_H*/
@@ -0,0 +1,245 @@
+#ifndef CORE_INTRINSICS_H
+#define CORE_INTRINSICS_H
+#include <stdint.h>
+
+/******************* Cortex-M4 Core Register Access *******************/
+
+/**
+ * @brief Reads PRIMASK, 1 when every configurable interrupt is masked.
+ */
+static inline uint32_t CORE_GetPRIMASK(void)
+{
+	uint32_t Value;
+	__asm volatile ("MRS %0, primask" : "=r" (Value));
+	return Value;
+}
+
+/**
+ * @brief Restores PRIMASK, typically with the value returned by CORE_GetPRIMASK().
+ */
+static inline void CORE_SetPRIMASK(uint32_t Value)
+{
+	__asm volatile ("MSR primask, %0" : : "r" (Value) : "memory");
+}
+
+/**
+ * @brief Masks every configurable interrupt (CPSID i).
+ */
+static inline void CORE_DisableIRQ(void)
+{
+	__asm volatile ("CPSID i" : : : "memory");
+}
+
+/**
+ * @brief Unmasks configurable interrupts (CPSIE i).
+ */
+static inline void CORE_EnableIRQ(void)
+{
+	__asm volatile ("CPSIE i" : : : "memory");
+}
+
+/**
+ * @brief Masks interrupts and returns the previous PRIMASK, for short critical sections.
+ */
+static inline uint32_t CORE_EnterCritical(void)
+{
+	uint32_t State = CORE_GetPRIMASK();
+	CORE_DisableIRQ();
+	return State;
+}
+
+/**
+ * @brief Ends a critical section opened by CORE_EnterCritical().
+ */
+static inline void CORE_ExitCritical(uint32_t State)
+{
+	CORE_SetPRIMASK(State);
+}
+
+/**
+ * @brief Reads BASEPRI, the priority mask threshold (0 when disabled).
+ */
+static inline uint32_t CORE_GetBASEPRI(void)
+{
+	uint32_t Value;
+	__asm volatile ("MRS %0, basepri" : "=r" (Value));
+	return Value;
+}
+
+/**
+ * @brief Writes BASEPRI: interrupts with a priority value >= Value are masked, 0 unmasks all.
+ */
+static inline void CORE_SetBASEPRI(uint32_t Value)
+{
+	__asm volatile ("MSR basepri, %0" : : "r" (Value) : "memory");
+}
+
+/**
+ * @brief Reads IPSR: 0 in thread mode, otherwise the exception number (IRQn + 16).
+ */
+static inline uint32_t CORE_GetIPSR(void)
+{
+	uint32_t Value;
+	__asm volatile ("MRS %0, ipsr" : "=r" (Value));
+	return Value;
+}
+
+/******************* Memory Barriers *******************/
+
+#if defined(__arm__)
+
+/**
+ * @brief Data Synchronization Barrier: completes every outstanding memory access.
+ */
+static inline void CORE_DSB(void)
+{
+	__asm volatile ("DSB 0xF" : : : "memory");
+}
+
+/**
+ * @brief Instruction Synchronization Barrier: flushes the pipeline.
+ */
+static inline void CORE_ISB(void)
+{
+	__asm volatile ("ISB 0xF" : : : "memory");
+}
+
+/**
+ * @brief Data Memory Barrier: orders memory accesses.
+ */
+static inline void CORE_DMB(void)
+{
+	__asm volatile ("DMB 0xF" : : : "memory");
+}
+
+#else
+
+/* Host builds (POSIX port, host tests): full compiler and CPU fences */
+static inline void CORE_DSB(void)
+{
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+static inline void CORE_ISB(void)
+{
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+static inline void CORE_DMB(void)
+{
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+#endif
+
+/**
+ * @brief Wait For Interrupt: sleeps until an interrupt is pending, even one masked by PRIMASK.
+ */
+static inline void CORE_WFI(void)
+{
+	__asm volatile ("WFI" : : : "memory");
+}
+
+/******************* Exclusive Access and Bit Scan *******************/
+
+/**
+ * @brief LDREX: loads a word and arms the exclusive monitor.
+ */
+static inline uint32_t CORE_LDREXW(volatile uint32_t* Address)
+{
+	uint32_t Value;
+	__asm volatile ("LDREX %0, %1" : "=r" (Value) : "Q" (*Address));
+	return Value;
+}
+
+/**
+ * @brief STREX: stores a word if the monitor is still armed; 0 on success, 1 when the
+ *        store was abandoned (an exception or another store came in between).
+ */
+static inline uint32_t CORE_STREXW(uint32_t Value, volatile uint32_t* Address)
+{
+	uint32_t Failed;
+	__asm volatile ("STREX %0, %2, %1" : "=&r" (Failed), "=Q" (*Address) : "r" (Value) : "memory");
+	return Failed;
+}
+
+/**
+ * @brief CLREX: disarms the exclusive monitor.
+ */
+static inline void CORE_CLREX(void)
+{
+	__asm volatile ("CLREX" : : : "memory");
+}
+
+/**
+ * @brief Atomically ORs Bits into a word with LDREX/STREX; returns the word before the OR.
+ */
+static inline uint32_t CORE_AtomicFetchOr(volatile uint32_t* Address, uint32_t Bits)
+{
+	uint32_t Previous;
+	do
+	{
+		Previous = CORE_LDREXW(Address);
+	} while (CORE_STREXW(Previous | Bits, Address) != 0U);
+	return Previous;
+}
+
+/**
+ * @brief Atomically replaces a word with LDREX/STREX; returns the word before the swap.
+ */
+static inline uint32_t CORE_AtomicSwap(volatile uint32_t* Address, uint32_t Value)
+{
+	uint32_t Previous;
+	do
+	{
+		Previous = CORE_LDREXW(Address);
+	} while (CORE_STREXW(Value, Address) != 0U);
+	return Previous;
+}
+
+/**
+ * @brief CLZ: number of leading zero bits, 32 for 0.
+ */
+static inline uint32_t CORE_CLZ(uint32_t Value)
+{
+	uint32_t Result;
+	__asm ("CLZ %0, %1" : "=r" (Result) : "r" (Value));
+	return Result;
+}
+
+/******************* DSP Extension (SIMD) *******************/
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+
+/**
+ * @brief SMLAD: Acc + X.lo * Y.lo + X.hi * Y.hi, signed 16-bit halves, 32-bit accumulator.
+ */
+static inline int32_t CORE_SMLAD(uint32_t X, uint32_t Y, int32_t Acc)
+{
+	int32_t Result;
+	__asm ("SMLAD %0, %1, %2, %3" : "=r" (Result) : "r" (X), "r" (Y), "r" (Acc));
+	return Result;
+}
+
+/**
+ * @brief SMLALD: as CORE_SMLAD() with a 64-bit accumulator, which cannot overflow in a block.
+ */
+static inline int64_t CORE_SMLALD(uint32_t X, uint32_t Y, int64_t Acc)
+{
+	__asm ("SMLALD %Q0, %R0, %1, %2" : "+r" (Acc) : "r" (X), "r" (Y));
+	return Acc;
+}
+
+/**
+ * @brief QADD16: two saturating signed 16-bit additions.
+ */
+static inline uint32_t CORE_QADD16(uint32_t X, uint32_t Y)
+{
+	uint32_t Result;
+	__asm ("QADD16 %0, %1, %2" : "=r" (Result) : "r" (X), "r" (Y));
+	return Result;
+}
+
+#endif
+
+#endif
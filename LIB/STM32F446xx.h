@@ -4,11 +4,17 @@
 /******************* Various Memories Base Addresses *******************/
 #define FLASH_BASE_ADDRESS           0x08000000UL
 #define SRAM_BASE_ADDRESS			 0x20000000UL
+#define SRAM_SIZE					 0x00020000UL   /* 128 KB (SRAM1 + SRAM2) */
 #define ROM_BASE_ADDRESS			 0x1FFF0000UL
+#define BKPSRAM_BASE_ADDRESS		 0x40024000UL
+#define BKPSRAM_SIZE				 0x1000UL       /* 4 KB backup SRAM */
 
 /******************* Core Preipherals Base Addresses *******************/
 
 #define NVIC_BASE_ADDRESS			 0xE000E100UL
+#define DWT_BASE_ADDRESS			 0xE0001000UL
+#define SCB_BASE_ADDRESS			 0xE000ED00UL
+#define COREDEBUG_BASE_ADDRESS		 0xE000EDF0UL
 
 /******************* AHB1 Preipherals Base Addresses *******************/
 #define GPIOA_BASE_ADDRESS			 0x40020000U
@@ -21,12 +27,18 @@
 #define GPIOH_BASE_ADDRESS			 0x40021C00U
 	 
 #define RCC_BASE_ADDRESS 			 0x40023800U
+#define FLASHIF_BASE_ADDRESS		 0x40023C00U
+
+#define DMA1_BASE_ADDRESS			 0x40026000U
+#define DMA2_BASE_ADDRESS			 0x40026400U
 
 /******************* AHB2 Preipherals Base Addresses *******************/
 
 /******************* AHB3 Preipherals Base Addresses *******************/
 
 /******************* APB1 Preipherals Base Addresses *******************/
+#define WWDG_BASE_ADDRESS			 0x40002C00U
+#define PWR_BASE_ADDRESS			 0x40007000U
 #define USART2_BASE_ADDRESS			 0x40004400
 #define USART3_BASE_ADDRESS			 0x40004800
 #define UART4_BASE_ADDRESS			 0x40004C00
@@ -35,6 +47,9 @@
 /******************* APB2 Preipherals Base Addresses *******************/
 #define USART1_BASE_ADDRESS			 0x40011000
 #define USART6_BASE_ADDRESS			 0x40011400
+#define SDIO_BASE_ADDRESS			 0x40012C00U
+#define SAI1_BASE_ADDRESS			 0x40015800U
+#define SAI2_BASE_ADDRESS			 0x40015C00U
 
 /******************* GPIO Register Definition Structure *******************/
 
@@ -105,6 +120,10 @@ typedef struct
 	
 }RCC_RegDef_t;
 
+/******************* RCC Preipheral Base Address *******************/
+
+#define RCC_REG               ((RCC_RegDef_t*)RCC_BASE_ADDRESS)   /*!< RCC_REG avoids the clash with the RCC entry of IRQn_Type */
+
 
 /******************* NVIC Register Definition Structure *******************/
 
@@ -135,6 +154,70 @@ typedef struct
 
 #define NVIC                  ((NVIC_RegDef_t*)NVIC_BASE_ADDRESS)   /*!< Pointer to NVIC_RegDef Struct*/
 
+/******************* SCB Register Definition Structure *******************/
+
+typedef struct
+{
+	volatile uint32_t CPUID;         	/*!< CPUID Base Register, 0xE000ED00 */
+	volatile uint32_t ICSR;          	/*!< Interrupt Control and State Register: pending/active vector, 0xE000ED04 */
+	volatile uint32_t VTOR;          	/*!< Vector Table Offset Register, 0xE000ED08 */
+	volatile uint32_t AIRCR;         	/*!< Application Interrupt and Reset Control Register: priority grouping, reset request, 0xE000ED0C */
+	volatile uint32_t SCR;           	/*!< System Control Register: sleep behaviour, 0xE000ED10 */
+	volatile uint32_t CCR;           	/*!< Configuration and Control Register, 0xE000ED14 */
+	volatile uint8_t  SHPR[12];      	/*!< System Handler Priority Registers, one byte per system exception 4-15, 0xE000ED18 */
+	volatile uint32_t SHCSR;         	/*!< System Handler Control and State Register: fault enables, 0xE000ED24 */
+	volatile uint32_t CFSR;          	/*!< Configurable Fault Status Register (MMFSR, BFSR, UFSR), 0xE000ED28 */
+	volatile uint32_t HFSR;          	/*!< HardFault Status Register, 0xE000ED2C */
+	volatile uint32_t DFSR;          	/*!< Debug Fault Status Register, 0xE000ED30 */
+	volatile uint32_t MMFAR;         	/*!< MemManage Fault Address Register, 0xE000ED34 */
+	volatile uint32_t BFAR;          	/*!< BusFault Address Register, 0xE000ED38 */
+	volatile uint32_t AFSR;          	/*!< Auxiliary Fault Status Register, 0xE000ED3C */
+} SCB_RegDef_t;
+
+/******************* SCB Base Address *******************/
+
+#define SCB                   ((SCB_RegDef_t*)SCB_BASE_ADDRESS)   /*!< Pointer to SCB_RegDef Struct*/
+
+#define SCB_AIRCR_VECTKEY           0x05FA0000UL   /*!< Key required by every AIRCR write */
+#define SCB_AIRCR_SYSRESETREQ       2U             /*!< AIRCR system reset request bit */
+
+/******************* DWT Register Definition Structure *******************/
+
+typedef struct
+{
+	volatile uint32_t CTRL;          	/*!< DWT Control Register: counter enables, 0xE0001000 */
+	volatile uint32_t CYCCNT;        	/*!< DWT Cycle Count Register, 0xE0001004 */
+	volatile uint32_t CPICNT;        	/*!< DWT CPI Count Register: extra cycles of multi-cycle instructions (8 bits), 0xE0001008 */
+	volatile uint32_t EXCCNT;        	/*!< DWT Exception Overhead Count Register: entry/exit cycles (8 bits), 0xE000100C */
+	volatile uint32_t SLEEPCNT;      	/*!< DWT Sleep Count Register: cycles spent sleeping (8 bits), 0xE0001010 */
+	volatile uint32_t LSUCNT;        	/*!< DWT LSU Count Register: extra load/store cycles (8 bits), 0xE0001014 */
+	volatile uint32_t FOLDCNT;       	/*!< DWT Folded-instruction Count Register (8 bits), 0xE0001018 */
+	volatile uint32_t PCSR;          	/*!< DWT Program Counter Sample Register, 0xE000101C */
+} DWT_RegDef_t;
+
+/******************* CoreDebug Register Definition Structure *******************/
+
+typedef struct
+{
+	volatile uint32_t DHCSR;         	/*!< Debug Halting Control and Status Register, 0xE000EDF0 */
+	volatile uint32_t DCRSR;         	/*!< Debug Core Register Selector Register, 0xE000EDF4 */
+	volatile uint32_t DCRDR;         	/*!< Debug Core Register Data Register, 0xE000EDF8 */
+	volatile uint32_t DEMCR;         	/*!< Debug Exception and Monitor Control Register: TRCENA enables the DWT, 0xE000EDFC */
+} CoreDebug_RegDef_t;
+
+/******************* DWT and CoreDebug Base Addresses *******************/
+
+#define DWT                   ((DWT_RegDef_t*)DWT_BASE_ADDRESS)             /*!< Pointer to DWT_RegDef Struct*/
+#define COREDEBUG             ((CoreDebug_RegDef_t*)COREDEBUG_BASE_ADDRESS) /*!< Pointer to CoreDebug_RegDef Struct*/
+
+#define COREDEBUG_DEMCR_TRCENA      24U     /*!< DEMCR trace enable bit, gates the DWT and ITM */
+#define DWT_CTRL_CYCCNTENA          0U      /*!< DWT CTRL cycle counter enable bit */
+#define DWT_CTRL_CPIEVTENA          17U     /*!< DWT CTRL CPI counter enable bit */
+#define DWT_CTRL_EXCEVTENA          18U     /*!< DWT CTRL exception overhead counter enable bit */
+#define DWT_CTRL_SLEEPEVTENA        19U     /*!< DWT CTRL sleep counter enable bit */
+#define DWT_CTRL_LSUEVTENA          20U     /*!< DWT CTRL LSU counter enable bit */
+#define DWT_CTRL_FOLDEVTENA         21U     /*!< DWT CTRL folded-instruction counter enable bit */
+
 /******************* USART Register Definition Structure *******************/
 typedef struct 
 {
@@ -155,6 +238,116 @@ typedef struct
 #define UART_5          ((USART_RegDef_t*)UART5_BASE_ADDRESS)  /*!< UART5 base address typecasted to USART_RegDef_t */
 #define USART_6         ((USART_RegDef_t*)USART6_BASE_ADDRESS) /*!< USART6 base address typecasted to USART_RegDef_t */
 
+/******************* DMA Register Definition Structure *******************/
+typedef struct
+{
+	volatile uint32_t CR;    /*!< DMA Stream x Configuration Register: channel, direction, sizes, increments and interrupt enables */
+	volatile uint32_t NDTR;  /*!< DMA Stream x Number of Data Register: items left to transfer */
+	volatile uint32_t PAR;   /*!< DMA Stream x Peripheral Address Register */
+	volatile uint32_t M0AR;  /*!< DMA Stream x Memory 0 Address Register */
+	volatile uint32_t M1AR;  /*!< DMA Stream x Memory 1 Address Register, used in double buffer mode */
+	volatile uint32_t FCR;   /*!< DMA Stream x FIFO Control Register */
+} DMA_Stream_RegDef_t;
+
+typedef struct
+{
+	volatile uint32_t LISR;  /*!< DMA Low Interrupt Status Register: flags of streams 0 to 3 */
+	volatile uint32_t HISR;  /*!< DMA High Interrupt Status Register: flags of streams 4 to 7 */
+	volatile uint32_t LIFCR; /*!< DMA Low Interrupt Flag Clear Register: clears flags of streams 0 to 3 */
+	volatile uint32_t HIFCR; /*!< DMA High Interrupt Flag Clear Register: clears flags of streams 4 to 7 */
+	DMA_Stream_RegDef_t Stream[8]; /*!< DMA Stream 0 to 7 registers, 0x10 - 0xCC */
+} DMA_RegDef_t;
+
+/******************* DMA Peripheral Base Address Macros *******************/
+#define DMA_1           ((DMA_RegDef_t*)DMA1_BASE_ADDRESS) /*!< DMA1 base address typecasted to DMA_RegDef_t */
+#define DMA_2           ((DMA_RegDef_t*)DMA2_BASE_ADDRESS) /*!< DMA2 base address typecasted to DMA_RegDef_t */
+
+/******************* SDIO Register Definition Structure *******************/
+typedef struct
+{
+	volatile uint32_t POWER;     /*!< SDIO Power Control Register */
+	volatile uint32_t CLKCR;     /*!< SDIO Clock Control Register: divider, bypass and bus width */
+	volatile uint32_t ARG;       /*!< SDIO Argument Register: argument of the next command */
+	volatile uint32_t CMD;       /*!< SDIO Command Register: index, response type and CPSM enable */
+	volatile uint32_t RESPCMD;   /*!< SDIO Command Response Register: index of the last response */
+	volatile uint32_t RESP[4];   /*!< SDIO Response 1..4 Registers */
+	volatile uint32_t DTIMER;    /*!< SDIO Data Timer Register: data timeout in card bus clock periods */
+	volatile uint32_t DLEN;      /*!< SDIO Data Length Register: bytes of the next data transfer */
+	volatile uint32_t DCTRL;     /*!< SDIO Data Control Register: direction, block size and DMA enable */
+	volatile uint32_t DCOUNT;    /*!< SDIO Data Counter Register */
+	volatile uint32_t STA;       /*!< SDIO Status Register */
+	volatile uint32_t ICR;       /*!< SDIO Interrupt Clear Register */
+	volatile uint32_t MASK;      /*!< SDIO Mask Register: interrupt enables */
+	uint32_t          RESERVED0[2]; /*!< Reserved, 0x40-0x44 */
+	volatile uint32_t FIFOCNT;   /*!< SDIO FIFO Counter Register */
+	uint32_t          RESERVED1[13]; /*!< Reserved, 0x4C-0x7C */
+	volatile uint32_t FIFO;      /*!< SDIO Data FIFO Register, 0x80 - 0xFC */
+} SDIO_RegDef_t;
+
+/******************* SDIO Peripheral Base Address Macro *******************/
+#define SDIO_REG        ((SDIO_RegDef_t*)SDIO_BASE_ADDRESS) /*!< SDIO_REG avoids the clash with the SDIO entry of IRQn_Type */
+
+/******************* PWR Register Definition Structure *******************/
+typedef struct
+{
+	volatile uint32_t CR;     /*!< PWR Power Control Register: DBP unlocks the backup domain */
+	volatile uint32_t CSR;    /*!< PWR Power Control/Status Register: BRE/BRR control the backup regulator */
+} PWR_RegDef_t;
+
+/******************* PWR Peripheral Base Address Macro *******************/
+#define PWR             ((PWR_RegDef_t*)PWR_BASE_ADDRESS)   /*!< PWR base address typecasted to PWR_RegDef_t */
+
+#define PWR_CSR_BRR                 3U      /*!< PWR CSR backup regulator ready flag */
+#define PWR_CSR_BRE                 9U      /*!< PWR CSR backup regulator enable bit */
+
+/******************* FLASH Interface Register Definition Structure *******************/
+typedef struct
+{
+	volatile uint32_t ACR;      /*!< FLASH Access Control Register: latency and caches */
+	volatile uint32_t KEYR;     /*!< FLASH Key Register: unlocks CR */
+	volatile uint32_t OPTKEYR;  /*!< FLASH Option Key Register */
+	volatile uint32_t SR;       /*!< FLASH Status Register: BSY and error flags */
+	volatile uint32_t CR;       /*!< FLASH Control Register: program, sector erase, lock */
+	volatile uint32_t OPTCR;    /*!< FLASH Option Control Register */
+} FLASH_RegDef_t;
+
+/******************* FLASH Interface Base Address Macro *******************/
+#define FLASH_REG       ((FLASH_RegDef_t*)FLASHIF_BASE_ADDRESS)   /*!< FLASH_REG avoids the clash with the FLASH entry of IRQn_Type */
+
+/******************* WWDG Register Definition Structure *******************/
+typedef struct
+{
+	volatile uint32_t CR;     /*!< WWDG Control Register: 7-bit down counter T[6:0] and activation bit WDGA */
+	volatile uint32_t CFR;    /*!< WWDG Configuration Register: window W[6:0], prescaler WDGTB and early wakeup EWI */
+	volatile uint32_t SR;     /*!< WWDG Status Register: early wakeup interrupt flag EWIF */
+} WWDG_RegDef_t;
+
+/******************* WWDG Peripheral Base Address Macro *******************/
+#define WWDG_REG        ((WWDG_RegDef_t*)WWDG_BASE_ADDRESS) /*!< WWDG_REG avoids the clash with the WWDG entry of IRQn_Type */
+
+/******************* SAI Register Definition Structure *******************/
+typedef struct
+{
+	volatile uint32_t CR1;    /*!< SAI Block x Configuration Register 1: mode, protocol, data size, DMA and enable */
+	volatile uint32_t CR2;    /*!< SAI Block x Configuration Register 2: FIFO threshold and flush */
+	volatile uint32_t FRCR;   /*!< SAI Block x Frame Configuration Register */
+	volatile uint32_t SLOTR;  /*!< SAI Block x Slot Register */
+	volatile uint32_t IMR;    /*!< SAI Block x Interrupt Mask Register */
+	volatile uint32_t SR;     /*!< SAI Block x Status Register */
+	volatile uint32_t CLRFR;  /*!< SAI Block x Clear Flag Register */
+	volatile uint32_t DR;     /*!< SAI Block x Data Register */
+} SAI_Block_RegDef_t;
+
+typedef struct
+{
+	volatile uint32_t GCR;          /*!< SAI Global Configuration Register */
+	SAI_Block_RegDef_t Block[2];    /*!< SAI Block A (0x04) and Block B (0x24) registers */
+} SAI_RegDef_t;
+
+/******************* SAI Peripheral Base Address Macros *******************/
+#define SAI_1           ((SAI_RegDef_t*)SAI1_BASE_ADDRESS) /*!< SAI1 base address typecasted to SAI_RegDef_t */
+#define SAI_2           ((SAI_RegDef_t*)SAI2_BASE_ADDRESS) /*!< SAI2 base address typecasted to SAI_RegDef_t */
+
 
 
 
@@ -0,0 +1,181 @@
+/**
+ * @file BOOTPROF_Program.c
+ * @brief Program for the boot-time interrupt readiness profiler.
+ *
+ * This file keeps a fixed table of NVIC calls and a timeline of subsystems, both filled
+ * during the boot. The recording state lives in .bss, which the startup code clears after
+ * BOOTPROF_Start() has run: recording starts as soon as main() opens the first subsystem
+ * or the first hooked call is made.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/BOOTPROF_Interface.h"
+#include "../Inc/BOOTPROF_Private.h"
+#include "../../../LIB/STM32F446xx.h"
+#include "../../../LIB/CORE_Intrinsics.h"
+#include "../../../LIB/ErrType.h"
+
+static BOOTPROF_Record_t BOOTPROF_Records[BOOTPROF_MAX_RECORDS];
+static BOOTPROF_Subsystem_t BOOTPROF_Timeline[BOOTPROF_MAX_SUBSYSTEMS];
+static uint32_t BOOTPROF_RecordCount = 0U;
+static uint32_t BOOTPROF_Dropped = 0U;
+static uint32_t BOOTPROF_SubsystemCount = 0U;
+static uint8_t BOOTPROF_Finished = 0U;
+
+static BOOTPROF_Subsystem_t* BOOTPROF_Current(uint32_t Now);
+
+/**
+ * @brief Starts the cycle counter from zero.
+ */
+void BOOTPROF_Start(void)
+{
+    COREDEBUG->DEMCR |= (1UL << COREDEBUG_DEMCR_TRCENA);
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= (1UL << DWT_CTRL_CYCCNTENA);
+}
+
+/**
+ * @brief Opens the timeline entry of a subsystem, closing the previous one.
+ *
+ * Past BOOTPROF_MAX_SUBSYSTEMS entries the last one keeps growing.
+ */
+void BOOTPROF_Subsystem(const char* Name)
+{
+    uint32_t Now = DWT->CYCCNT;
+    uint32_t State = 0U;
+    BOOTPROF_Subsystem_t* Entry = 0;
+
+    if (BOOTPROF_Finished != 0U)
+    {
+        return;
+    }
+
+    State = CORE_EnterCritical();
+    if (BOOTPROF_SubsystemCount < BOOTPROF_MAX_SUBSYSTEMS)
+    {
+        if (BOOTPROF_SubsystemCount != 0U)
+        {
+            BOOTPROF_Timeline[BOOTPROF_SubsystemCount - 1U].End = Now;
+        }
+        Entry = &BOOTPROF_Timeline[BOOTPROF_SubsystemCount];
+        BOOTPROF_SubsystemCount++;
+        Entry->Name = Name;
+        Entry->Begin = Now;
+        Entry->End = Now;
+    }
+    CORE_ExitCritical(State);
+}
+
+/**
+ * @brief Records an NVIC call.
+ */
+void BOOTPROF_Hook(BOOTPROF_Event_t Event, IRQn_Type IRQn, uint32_t Value)
+{
+    uint32_t Now = DWT->CYCCNT;
+    uint32_t State = 0U;
+    BOOTPROF_Subsystem_t* Entry = 0;
+    BOOTPROF_Record_t* Record = 0;
+
+    if (BOOTPROF_Finished != 0U)
+    {
+        return;
+    }
+
+    State = CORE_EnterCritical();
+    Entry = BOOTPROF_Current(Now);
+
+    if (Event == BOOTPROF_EVENT_ENABLE)
+    {
+        if (Entry->Enables == 0U)
+        {
+            Entry->FirstEnable = Now;
+        }
+        Entry->LastEnable = Now;
+        Entry->Enables++;
+    }
+    else
+    {
+        Entry->Priorities++;
+    }
+    Entry->End = Now;
+
+    if (BOOTPROF_RecordCount < BOOTPROF_MAX_RECORDS)
+    {
+        Record = &BOOTPROF_Records[BOOTPROF_RecordCount];
+        BOOTPROF_RecordCount++;
+        Record->Cycles = Now;
+        Record->Event = (uint8_t)Event;
+        Record->IRQn = (uint8_t)IRQn;
+        Record->Value = (uint8_t)Value;
+        Record->Subsystem = (uint8_t)(Entry - BOOTPROF_Timeline);
+    }
+    else
+    {
+        BOOTPROF_Dropped++;
+    }
+    CORE_ExitCritical(State);
+}
+
+/**
+ * @brief Closes the timeline and stops recording.
+ */
+uint32_t BOOTPROF_Finish(void)
+{
+    uint32_t Now = DWT->CYCCNT;
+
+    if ((BOOTPROF_Finished == 0U) && (BOOTPROF_SubsystemCount != 0U))
+    {
+        BOOTPROF_Timeline[BOOTPROF_SubsystemCount - 1U].End = Now;
+    }
+    BOOTPROF_Finished = 1U;
+
+    return Now;
+}
+
+/**
+ * @brief Returns the recorded NVIC calls.
+ */
+const BOOTPROF_Record_t* BOOTPROF_GetRecords(uint32_t* Count, uint32_t* Dropped)
+{
+    if (Count != 0)
+    {
+        *Count = BOOTPROF_RecordCount;
+    }
+    if (Dropped != 0)
+    {
+        *Dropped = BOOTPROF_Dropped;
+    }
+
+    return BOOTPROF_Records;
+}
+
+/**
+ * @brief Returns the per-subsystem timeline.
+ */
+const BOOTPROF_Subsystem_t* BOOTPROF_GetTimeline(uint32_t* Count)
+{
+    if (Count != 0)
+    {
+        *Count = BOOTPROF_SubsystemCount;
+    }
+
+    return BOOTPROF_Timeline;
+}
+
+/**
+ * @brief Returns the open timeline entry, opening the default one for early calls.
+ */
+static BOOTPROF_Subsystem_t* BOOTPROF_Current(uint32_t Now)
+{
+    if (BOOTPROF_SubsystemCount == 0U)
+    {
+        BOOTPROF_Timeline[0].Name = BOOTPROF_DEFAULT_NAME;
+        BOOTPROF_Timeline[0].Begin = 0U;
+        BOOTPROF_Timeline[0].End = Now;
+        BOOTPROF_SubsystemCount = 1U;
+    }
+
+    return &BOOTPROF_Timeline[BOOTPROF_SubsystemCount - 1U];
+}
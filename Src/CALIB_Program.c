@@ -0,0 +1,233 @@
+/**
+ * @file CALIB_Program.c
+ * @brief Program for the interrupt latency calibration.
+ *
+ * This file runs the measurement cases. Every trigger is a STIR write stamped with
+ * CYCCNT just before it; the handler that is taken stamps CYCCNT first thing. For the
+ * tail chain the probe handler pends the chain IRQ at its own level, which cannot
+ * preempt, and stamps CYCCNT as its last statement.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/CALIB_Interface.h"
+#include "../Inc/CALIB_Private.h"
+#include "../Inc/NVIC_Interface.h"
+#include "../../../LIB/STM32F446xx.h"
+#include "../../../LIB/CORE_Intrinsics.h"
+#include "../../../LIB/ErrType.h"
+
+static CALIB_Results_t CALIB_Results;
+static volatile CALIB_Mode_t CALIB_Mode = CALIB_MODE_IDLE;
+static volatile uint32_t CALIB_Start = 0U;    /**< CYCCNT before the trigger, or at the end of the probe */
+static volatile uint32_t CALIB_Stop = 0U;     /**< CYCCNT at the entry of the measured handler */
+static volatile uint8_t CALIB_Done = 0U;
+
+static void CALIB_Measure(CALIB_Mode_t Mode, CALIB_Stat_t* Stat);
+static void CALIB_Record(CALIB_Stat_t* Stat, uint32_t Cycles);
+static void CALIB_Trigger(IRQn_Type IRQn);
+static uint32_t CALIB_IsEnabled(IRQn_Type IRQn);
+
+/**
+ * @brief Measures every case at every level.
+ */
+uint8_t CALIB_Run(uint32_t Samples)
+{
+    uint32_t ProbePriority = NVIC_GetPriority(CALIB_IRQ_PROBE);
+    uint32_t ChainPriority = NVIC_GetPriority(CALIB_IRQ_CHAIN);
+    uint32_t ProbeEnabled = CALIB_IsEnabled(CALIB_IRQ_PROBE);
+    uint32_t ChainEnabled = CALIB_IsEnabled(CALIB_IRQ_CHAIN);
+    uint32_t PreviousBasePri = 0U;
+    uint32_t Level = 0U;
+    uint32_t Sample = 0U;
+    uint32_t Start = 0U;
+    uint32_t Cycles = 0U;
+
+    if ((CORE_GetIPSR() != 0U) || (CORE_GetPRIMASK() != 0U))
+    {
+        return NOK;
+    }
+
+    COREDEBUG->DEMCR |= (1UL << COREDEBUG_DEMCR_TRCENA);
+    DWT->CTRL |= (1UL << DWT_CTRL_CYCCNTENA);
+    PreviousBasePri = CORE_GetBASEPRI();
+    CORE_SetBASEPRI(0U);
+
+    CALIB_Results = (CALIB_Results_t){ 0 };
+    CALIB_Results.Overhead = 0xFFFFFFFFUL;
+    for (Sample = 0U; Sample < CALIB_OVERHEAD_RUNS; Sample++)
+    {
+        Start = DWT->CYCCNT;
+        Cycles = DWT->CYCCNT - Start;
+        if (Cycles < CALIB_Results.Overhead)
+        {
+            CALIB_Results.Overhead = Cycles;
+        }
+    }
+
+    NVIC_EnableIRQClean(CALIB_IRQ_PROBE);
+    NVIC_EnableIRQClean(CALIB_IRQ_CHAIN);
+
+    for (Level = 0U; Level < CALIB_LEVELS; Level++)
+    {
+        NVIC_SetPriority(CALIB_IRQ_PROBE, Level);
+        for (Sample = 0U; Sample < Samples; Sample++)
+        {
+            NVIC_SetPriority(CALIB_IRQ_CHAIN, Level);
+            CALIB_Measure(CALIB_MODE_ENTRY, &CALIB_Results.Entry[Level]);
+            CALIB_Measure(CALIB_MODE_TAIL, &CALIB_Results.TailChain[Level]);
+            if (Level < (CALIB_LEVELS - 1U))
+            {
+                NVIC_SetPriority(CALIB_IRQ_CHAIN, CALIB_LEVELS - 1U);
+                CALIB_Measure(CALIB_MODE_PREEMPT, &CALIB_Results.Preempt[Level]);
+            }
+        }
+    }
+
+    if (ProbeEnabled == 0U)
+    {
+        (void)NVIC_DisableIRQSync(CALIB_IRQ_PROBE);
+    }
+    if (ChainEnabled == 0U)
+    {
+        (void)NVIC_DisableIRQSync(CALIB_IRQ_CHAIN);
+    }
+    NVIC_SetPriority(CALIB_IRQ_PROBE, ProbePriority);
+    NVIC_SetPriority(CALIB_IRQ_CHAIN, ChainPriority);
+    CORE_SetBASEPRI(PreviousBasePri);
+
+    return (CALIB_Results.Lost == 0U) ? OK : NOK;
+}
+
+/**
+ * @brief Returns the results of the last CALIB_Run().
+ */
+const CALIB_Results_t* CALIB_GetResults(void)
+{
+    return &CALIB_Results;
+}
+
+/**
+ * @brief Body of the CALIB_IRQ_PROBE handler.
+ */
+void CALIB_ProbeHandler(void)
+{
+    uint32_t Now = DWT->CYCCNT;
+
+    switch (CALIB_Mode)
+    {
+    case CALIB_MODE_ENTRY:
+    case CALIB_MODE_PREEMPT:
+        CALIB_Stop = Now;
+        CALIB_Done = 1U;
+        break;
+
+    case CALIB_MODE_TAIL:
+        NVIC->STIR = (uint32_t)CALIB_IRQ_CHAIN;   /**< Same level: pends until this handler ends */
+        CALIB_Start = DWT->CYCCNT;
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Body of the CALIB_IRQ_CHAIN handler.
+ */
+void CALIB_ChainHandler(void)
+{
+    uint32_t Now = DWT->CYCCNT;
+
+    switch (CALIB_Mode)
+    {
+    case CALIB_MODE_PREEMPT:
+        CALIB_Trigger(CALIB_IRQ_PROBE);           /**< The probe preempts this handler here */
+        break;
+
+    case CALIB_MODE_TAIL:
+        CALIB_Stop = Now;
+        CALIB_Done = 1U;
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Takes one sample of a case; a trigger whose handler did not run is counted as lost.
+ */
+static void CALIB_Measure(CALIB_Mode_t Mode, CALIB_Stat_t* Stat)
+{
+    uint32_t Wait = 0U;
+
+    CALIB_Done = 0U;
+    CALIB_Mode = Mode;
+
+    if (Mode == CALIB_MODE_ENTRY)
+    {
+        CALIB_Trigger(CALIB_IRQ_PROBE);
+    }
+    else if (Mode == CALIB_MODE_PREEMPT)
+    {
+        NVIC->STIR = (uint32_t)CALIB_IRQ_CHAIN;
+    }
+    else
+    {
+        NVIC->STIR = (uint32_t)CALIB_IRQ_PROBE;
+    }
+
+    while ((CALIB_Done == 0U) && (Wait < CALIB_WAIT_LIMIT))
+    {
+        Wait++;
+    }
+    CALIB_Mode = CALIB_MODE_IDLE;
+
+    if (CALIB_Done == 0U)
+    {
+        CALIB_Results.Lost++;
+        return;
+    }
+
+    CALIB_Record(Stat, CALIB_Stop - CALIB_Start);
+}
+
+/**
+ * @brief Adds a sample, less the cost of the two CYCCNT reads.
+ */
+static void CALIB_Record(CALIB_Stat_t* Stat, uint32_t Cycles)
+{
+    Cycles = (Cycles > CALIB_Results.Overhead) ? (Cycles - CALIB_Results.Overhead) : 0U;
+
+    if ((Stat->Count == 0U) || (Cycles < Stat->Min))
+    {
+        Stat->Min = Cycles;
+    }
+    if (Cycles > Stat->Max)
+    {
+        Stat->Max = Cycles;
+    }
+    Stat->Sum += Cycles;
+    Stat->Count++;
+}
+
+/**
+ * @brief Stamps CYCCNT and triggers an IRQ through STIR.
+ */
+static void CALIB_Trigger(IRQn_Type IRQn)
+{
+    CALIB_Start = DWT->CYCCNT;
+    NVIC->STIR = (uint32_t)IRQn;
+    CORE_DSB();
+    CORE_ISB();
+}
+
+/**
+ * @brief Reads the enable bit of an IRQ.
+ */
+static uint32_t CALIB_IsEnabled(IRQn_Type IRQn)
+{
+    return NVIC->ISER[(uint32_t)IRQn / 32U] & (1UL << ((uint32_t)IRQn % 32U));
+}
@@ -0,0 +1,486 @@
+/**
+ * @file CANSIM_Program.c
+ * @brief Program for the host simulation of a fleet of CAN nodes.
+ *
+ * This file implements the tick loop run by every worker thread, the arbitration run by
+ * one of them between two ticks, and each node's bxCAN-like interrupt flow on its own
+ * NVIC_Model_t.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "../Inc/CANSIM_Interface.h"
+#include "../Inc/CANSIM_Private.h"
+#include "../Inc/NVIC_Model_Interface.h"
+#include "../../../LIB/ErrType.h"
+
+/**
+ * @brief Worker thread argument: the simulation and the slice of nodes it owns.
+ */
+typedef struct
+{
+    CANSIM_Sim_t* Sim;
+    uint32_t First;
+    uint32_t Last;     /**< One past the last node */
+    pthread_mutex_t* Gate;
+} CANSIM_Worker_t;
+
+static void* CANSIM_Worker(void* Argument);
+static void CANSIM_Deliver(CANSIM_Node_t* Node);
+static void CANSIM_Dispatch(CANSIM_Node_t* Node);
+static void CANSIM_Offer(CANSIM_Node_t* Node);
+static void CANSIM_Arbitrate(CANSIM_Sim_t* Sim);
+
+/**
+ * @brief Allocates the fleet and configures every node's NVIC.
+ */
+uint8_t CANSIM_Create(CANSIM_Sim_t* Sim, const CANSIM_Config_t* Config)
+{
+    uint32_t Index = 0U;
+    CANSIM_Node_t* Node = 0;
+
+    if ((Sim == 0) || (Config == 0) || (Config->App == 0))
+    {
+        return NULL_PTR_ERR;
+    }
+    if ((Config->NodeCount == 0U) || (Config->NodeCount > 65535U) || (Config->ThreadCount == 0U) ||
+        (Config->ThreadCount > Config->NodeCount) || (Config->BitRate == 0U) || (Config->TickUs == 0U) ||
+        (Config->RxPriority >= NVIC_MODEL_LEVELS) || (Config->TxPriority >= NVIC_MODEL_LEVELS))
+    {
+        return NOK;
+    }
+
+    Sim->Config = *Config;
+    Sim->Nodes = calloc(Config->NodeCount, sizeof(CANSIM_Node_t));
+    Sim->Offers = calloc(Config->NodeCount, sizeof(CANSIM_Offer_t));
+    Sim->Barrier = malloc(sizeof(pthread_barrier_t));
+    if ((Sim->Nodes == 0) || (Sim->Offers == 0) || (Sim->Barrier == 0) ||
+        (pthread_barrier_init((pthread_barrier_t*)Sim->Barrier, 0, Config->ThreadCount) != 0))
+    {
+        free(Sim->Nodes);
+        free(Sim->Offers);
+        free(Sim->Barrier);
+        Sim->Nodes = 0;
+        return NOK;
+    }
+
+    Sim->OfferCount = 0U;
+    Sim->WinnerCount = 0U;
+    Sim->BitsPerTick = (uint32_t)(((uint64_t)Config->BitRate * Config->TickUs) / 1000000ULL);
+    Sim->Budget = 0U;
+    Sim->BusBits = 0U;
+    Sim->Ticks = 0U;
+    Sim->RunTicks = 0U;
+
+    for (Index = 0U; Index < Config->NodeCount; Index++)
+    {
+        Node = &Sim->Nodes[Index];
+        Node->Index = Index;
+        Node->Sim = Sim;
+        NVIC_Model_Reset(&Node->Nvic);
+        NVIC_Model_SetPriority(&Node->Nvic, CAN1_RX0, Config->RxPriority);
+        NVIC_Model_SetPriority(&Node->Nvic, CAN1_TX, Config->TxPriority);
+        NVIC_Model_SetEnabled(&Node->Nvic, CAN1_RX0, 1U);
+        NVIC_Model_SetEnabled(&Node->Nvic, CAN1_TX, 1U);
+    }
+
+    return OK;
+}
+
+/**
+ * @brief Frees a simulation created by CANSIM_Create().
+ */
+void CANSIM_Destroy(CANSIM_Sim_t* Sim)
+{
+    if ((Sim == 0) || (Sim->Nodes == 0))
+    {
+        return;
+    }
+
+    (void)pthread_barrier_destroy((pthread_barrier_t*)Sim->Barrier);
+    free(Sim->Barrier);
+    free(Sim->Nodes);
+    free(Sim->Offers);
+    Sim->Barrier = 0;
+    Sim->Nodes = 0;
+    Sim->Offers = 0;
+}
+
+/**
+ * @brief Simulates a number of ticks on the thread pool, returning when they are done.
+ *
+ * Nodes are split in contiguous slices, one per thread; the caller runs the first slice.
+ */
+uint8_t CANSIM_Run(CANSIM_Sim_t* Sim, uint32_t Ticks)
+{
+    uint32_t ThreadCount = 0U;
+    uint32_t Thread = 0U;
+    uint32_t Started = 0U;
+    CANSIM_Worker_t* Workers = 0;
+    pthread_t* Threads = 0;
+    pthread_mutex_t Gate = PTHREAD_MUTEX_INITIALIZER;
+    uint8_t Status = OK;
+
+    if (Sim == 0)
+    {
+        return NULL_PTR_ERR;
+    }
+
+    ThreadCount = Sim->Config.ThreadCount;
+    Workers = calloc(ThreadCount, sizeof(CANSIM_Worker_t));
+    Threads = calloc(ThreadCount, sizeof(pthread_t));
+    if ((Workers == 0) || (Threads == 0))
+    {
+        free(Workers);
+        free(Threads);
+        return NOK;
+    }
+
+    Sim->RunTicks = Ticks;
+    for (Thread = 0U; Thread < ThreadCount; Thread++)
+    {
+        Workers[Thread].Sim = Sim;
+        Workers[Thread].First = (uint32_t)(((uint64_t)Sim->Config.NodeCount * Thread) / ThreadCount);
+        Workers[Thread].Last = (uint32_t)(((uint64_t)Sim->Config.NodeCount * (Thread + 1U)) / ThreadCount);
+        Workers[Thread].Gate = &Gate;
+    }
+
+    /* The barrier counts every thread: none may enter it unless all of them started */
+    (void)pthread_mutex_lock(&Gate);
+    for (Thread = 1U; Thread < ThreadCount; Thread++)
+    {
+        if (pthread_create(&Threads[Thread], 0, CANSIM_Worker, &Workers[Thread]) != 0)
+        {
+            Status = NOK;
+            break;
+        }
+        Started++;
+    }
+
+    if (Status != OK)
+    {
+        Sim->RunTicks = 0U;   /**< The started threads leave without a tick */
+    }
+    (void)pthread_mutex_unlock(&Gate);
+
+    if (Status == OK)
+    {
+        (void)CANSIM_Worker(&Workers[0]);
+    }
+
+    for (Thread = 1U; Thread <= Started; Thread++)
+    {
+        (void)pthread_join(Threads[Thread], 0);
+    }
+
+    free(Workers);
+    free(Threads);
+
+    return Status;
+}
+
+/**
+ * @brief Returns a node of the fleet.
+ */
+CANSIM_Node_t* CANSIM_GetNode(CANSIM_Sim_t* Sim, uint32_t Index)
+{
+    if ((Sim == 0) || (Index >= Sim->Config.NodeCount))
+    {
+        return 0;
+    }
+
+    return &Sim->Nodes[Index];
+}
+
+/**
+ * @brief Sets a node's acceptance filter.
+ */
+void CANSIM_SetFilter(CANSIM_Node_t* Node, uint32_t Id, uint32_t Mask)
+{
+    Node->FilterId = Id & Mask;
+    Node->FilterMask = Mask;
+}
+
+/**
+ * @brief Places a frame in a free transmit mailbox of the calling node.
+ */
+uint8_t CANSIM_Transmit(CANSIM_Node_t* Node, const CANSIM_Frame_t* Frame)
+{
+    uint8_t Mailbox = 0U;
+
+    if ((Node == 0) || (Frame == 0))
+    {
+        return NULL_PTR_ERR;
+    }
+
+    for (Mailbox = 0U; Mailbox < CANSIM_MAILBOXES; Mailbox++)
+    {
+        if ((Node->MailboxBusy & (1U << Mailbox)) == 0U)
+        {
+            Node->Mailbox[Mailbox] = *Frame;
+            Node->Mailbox[Mailbox].Dlc = (Frame->Dlc > 8U) ? 8U : Frame->Dlc;
+            Node->Mailbox[Mailbox].Sender = (uint16_t)Node->Index;
+            Node->MailboxBusy |= (uint8_t)(1U << Mailbox);
+            return OK;
+        }
+    }
+
+    return NOK;
+}
+
+/**
+ * @brief Reads and releases the oldest frame of FIFO 0.
+ */
+uint8_t CANSIM_Receive(CANSIM_Node_t* Node, CANSIM_Frame_t* Frame)
+{
+    if ((Node == 0) || (Frame == 0))
+    {
+        return NULL_PTR_ERR;
+    }
+    if (Node->FifoCount == 0U)
+    {
+        return NOK;
+    }
+
+    *Frame = Node->Fifo[Node->FifoHead];
+    Node->FifoHead = (uint8_t)((Node->FifoHead + 1U) % CANSIM_FIFO_DEPTH);
+    Node->FifoCount--;
+
+    return OK;
+}
+
+/**
+ * @brief Returns the bus load since creation, in per mille of the bit budget.
+ */
+uint32_t CANSIM_GetBusLoad(const CANSIM_Sim_t* Sim)
+{
+    uint64_t Capacity = 0U;
+
+    if (Sim == 0)
+    {
+        return 0U;
+    }
+
+    Capacity = Sim->Ticks * Sim->BitsPerTick;
+
+    return (Capacity == 0U) ? 0U : (uint32_t)((Sim->BusBits * 1000U) / Capacity);
+}
+
+/**
+ * @brief Tick loop of one worker thread.
+ *
+ * Between the two barriers the serial thread arbitrates the offers of the tick; the other
+ * threads wait, so the winners are stable while the nodes read them during the next tick.
+ */
+static void* CANSIM_Worker(void* Argument)
+{
+    CANSIM_Worker_t* Worker = (CANSIM_Worker_t*)Argument;
+    CANSIM_Sim_t* Sim = Worker->Sim;
+    const CANSIM_App_t* App = Sim->Config.App;
+    CANSIM_Node_t* Node = 0;
+    uint32_t Tick = 0U;
+    uint32_t Index = 0U;
+
+    (void)pthread_mutex_lock(Worker->Gate);
+    (void)pthread_mutex_unlock(Worker->Gate);
+
+    for (Tick = 0U; Tick < Sim->RunTicks; Tick++)
+    {
+        for (Index = Worker->First; Index < Worker->Last; Index++)
+        {
+            Node = &Sim->Nodes[Index];
+            CANSIM_Deliver(Node);
+            if (App->Tick != 0)
+            {
+                App->Tick(Node, (uint32_t)Sim->Ticks);   /**< Advanced by the serial thread only */
+            }
+            CANSIM_Offer(Node);
+        }
+
+        if (pthread_barrier_wait((pthread_barrier_t*)Sim->Barrier) == PTHREAD_BARRIER_SERIAL_THREAD)
+        {
+            CANSIM_Arbitrate(Sim);
+        }
+        (void)pthread_barrier_wait((pthread_barrier_t*)Sim->Barrier);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Reads the frames carried by the last tick: completes own transmissions, filters the others into FIFO 0.
+ *
+ * The frames followed one another on the bus, each for over 100 bit times, so the
+ * interrupts raised by one frame are taken before the next one is stored. Storing the
+ * whole tick first would overrun the 3-frame FIFO whenever a tick carries more frames.
+ */
+static void CANSIM_Deliver(CANSIM_Node_t* Node)
+{
+    const CANSIM_Sim_t* Sim = Node->Sim;
+    const CANSIM_Offer_t* Winner = 0;
+    uint32_t Index = 0U;
+
+    for (Index = 0U; Index < Sim->WinnerCount; Index++)
+    {
+        Winner = &Sim->Winners[Index];
+
+        if (Winner->Frame.Sender == Node->Index)
+        {
+            Node->MailboxBusy &= (uint8_t)~(1U << Winner->Mailbox);
+            Node->Stats.FramesSent++;
+            (void)NVIC_Model_SetPending(&Node->Nvic, CAN1_TX, 1U);
+        }
+        else if ((Winner->Frame.Id & Node->FilterMask) != Node->FilterId)
+        {
+            Node->Stats.FilteredOut++;
+        }
+        else if (Node->FifoCount == CANSIM_FIFO_DEPTH)
+        {
+            Node->Stats.RxOverruns++;
+        }
+        else
+        {
+            Node->Fifo[(Node->FifoHead + Node->FifoCount) % CANSIM_FIFO_DEPTH] = Winner->Frame;
+            Node->FifoCount++;
+            Node->Stats.FramesReceived++;
+            (void)NVIC_Model_SetPending(&Node->Nvic, CAN1_RX0, 1U);
+        }
+
+        CANSIM_Dispatch(Node);
+    }
+}
+
+/**
+ * @brief Takes the node's pending interrupts in NVIC order.
+ *
+ * CAN1_RX0 is level sensitive: it pends again while FIFO 0 is not empty.
+ */
+static void CANSIM_Dispatch(CANSIM_Node_t* Node)
+{
+    const CANSIM_App_t* App = Node->Sim->Config.App;
+    int32_t IRQn = NVIC_MODEL_NONE;
+
+    while ((IRQn = NVIC_Model_Next(&Node->Nvic, NVIC_MODEL_LEVELS)) != NVIC_MODEL_NONE)
+    {
+        NVIC_Model_Activate(&Node->Nvic, (IRQn_Type)IRQn);
+        if (IRQn == (int32_t)CAN1_RX0)
+        {
+            Node->Stats.RxIrqs++;
+            if (App->RxIrq != 0)
+            {
+                App->RxIrq(Node);
+            }
+        }
+        else if (IRQn == (int32_t)CAN1_TX)
+        {
+            Node->Stats.TxIrqs++;
+            if (App->TxIrq != 0)
+            {
+                App->TxIrq(Node);
+            }
+        }
+        else
+        {
+            /* Only the CAN interrupts are simulated */
+        }
+        NVIC_Model_Deactivate(&Node->Nvic, (IRQn_Type)IRQn);
+
+        if ((IRQn == (int32_t)CAN1_RX0) && (Node->FifoCount != 0U))
+        {
+            (void)NVIC_Model_SetPending(&Node->Nvic, CAN1_RX0, 1U);
+        }
+    }
+}
+
+/**
+ * @brief Offers the node's most urgent busy mailbox to the bus; the slot is claimed lock-free.
+ */
+static void CANSIM_Offer(CANSIM_Node_t* Node)
+{
+    CANSIM_Sim_t* Sim = Node->Sim;
+    uint8_t Mailbox = 0U;
+    uint8_t Best = CANSIM_MAILBOXES;
+    uint32_t Slot = 0U;
+
+    for (Mailbox = 0U; Mailbox < CANSIM_MAILBOXES; Mailbox++)
+    {
+        if (((Node->MailboxBusy & (1U << Mailbox)) != 0U) &&
+            ((Best == CANSIM_MAILBOXES) || (Node->Mailbox[Mailbox].Id < Node->Mailbox[Best].Id)))
+        {
+            Best = Mailbox;
+        }
+    }
+    if (Best == CANSIM_MAILBOXES)
+    {
+        return;
+    }
+
+    Slot = __atomic_fetch_add(&Sim->OfferCount, 1U, __ATOMIC_RELAXED);   /**< The barrier orders the stores */
+    Sim->Offers[Slot].Frame = Node->Mailbox[Best];
+    Sim->Offers[Slot].Mailbox = Best;
+}
+
+/**
+ * @brief Picks the frames carried by the tick: lowest identifier first while the bit budget lasts.
+ *
+ * A node offers one mailbox per tick. Offers that lose are counted and offered again by
+ * their node on the next tick.
+ */
+static void CANSIM_Arbitrate(CANSIM_Sim_t* Sim)
+{
+    uint32_t Count = Sim->OfferCount;
+    uint32_t Index = 0U;
+    uint32_t Best = 0U;
+    uint32_t Bits = 0U;
+    CANSIM_Offer_t Swap;
+
+    Sim->Budget += Sim->BitsPerTick;
+    Sim->WinnerCount = 0U;
+
+    /* Selection by identifier: the offers of a tick are few compared with the fleet */
+    while ((Sim->WinnerCount < Count) && (Sim->WinnerCount < CANSIM_MAX_WINNERS))
+    {
+        Best = Sim->WinnerCount;
+        for (Index = Best + 1U; Index < Count; Index++)
+        {
+            if (Sim->Offers[Index].Frame.Id < Sim->Offers[Best].Frame.Id)
+            {
+                Best = Index;
+            }
+        }
+
+        Bits = CANSIM_FRAME_BITS(Sim->Offers[Best].Frame.Dlc);
+        if (Bits > Sim->Budget)
+        {
+            break;
+        }
+        Sim->Budget -= Bits;
+        Sim->BusBits += Bits;
+
+        Swap = Sim->Offers[Sim->WinnerCount];
+        Sim->Offers[Sim->WinnerCount] = Sim->Offers[Best];
+        Sim->Offers[Best] = Swap;
+        Sim->Winners[Sim->WinnerCount] = Sim->Offers[Sim->WinnerCount];
+        Sim->WinnerCount++;
+    }
+
+    for (Index = Sim->WinnerCount; Index < Count; Index++)
+    {
+        Sim->Nodes[Sim->Offers[Index].Frame.Sender].Stats.ArbitrationLost++;
+    }
+
+    /* An idle bus does not bank bits: keep at most what a started frame could use */
+    if (Sim->Budget > CANSIM_MAX_FRAME_BITS)
+    {
+        Sim->Budget = CANSIM_MAX_FRAME_BITS;
+    }
+
+    Sim->OfferCount = 0U;
+    Sim->Ticks++;
+}
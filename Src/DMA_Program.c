@@ -0,0 +1,146 @@
+/**
+ * @file DMA_Program.c
+ * @brief Program for the DMA1/DMA2 stream driver.
+ *
+ * This file provides the function definitions required to configure, start and stop
+ * DMA streams and to manage their status flags.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/DMA_Interface.h"
+#include "../Inc/DMA_Private.h"
+#include "../../../LIB/STM32F446xx.h"
+#include "../../../LIB/ErrType.h"
+
+/**
+ * @brief Bit offset of each stream's flags inside LISR/HISR and LIFCR/HIFCR.
+ */
+static const uint8_t DMA_FlagShift[4] = { 0U, 6U, 16U, 22U };
+
+/**
+ * @brief Configures a DMA stream, leaving it disabled.
+ *
+ * @param[in] DMAx    DMA controller, DMA_1 or DMA_2.
+ * @param[in] Stream  Stream number 0-7.
+ * @param[in] Config  Stream configuration.
+ * @return uint8_t OK on success, NULL_PTR_ERR or NOK on invalid arguments.
+ */
+uint8_t DMA_StreamInit(DMA_RegDef_t* DMAx, uint8_t Stream, const DMA_StreamConfig_t* Config)
+{
+    uint8_t ErrorState = OK;
+    uint32_t Control = 0U;   /**< Value assembled for the SxCR register */
+    uint32_t Fifo = 0U;      /**< Value assembled for the SxFCR register */
+
+    if ((DMAx == 0) || (Config == 0))
+    {
+        ErrorState = NULL_PTR_ERR;
+    }
+    else if ((Stream >= DMA_STREAM_COUNT) || (Config->Channel > 7U) || (Config->Priority > 3U))
+    {
+        ErrorState = NOK;
+    }
+    else
+    {
+        DMA_StreamStop(DMAx, Stream);
+        DMA_ClearFlags(DMAx, Stream, DMA_FLAG_ALL);
+
+        Control = ((uint32_t)Config->Channel << DMA_SXCR_CHSEL)
+                | ((uint32_t)Config->MemBurst << DMA_SXCR_MBURST)
+                | ((uint32_t)Config->PeriphBurst << DMA_SXCR_PBURST)
+                | ((uint32_t)Config->Priority << DMA_SXCR_PL)
+                | ((uint32_t)Config->MemSize << DMA_SXCR_MSIZE)
+                | ((uint32_t)Config->PeriphSize << DMA_SXCR_PSIZE)
+                | ((uint32_t)(Config->MemIncrement & 1U) << DMA_SXCR_MINC)
+                | ((uint32_t)(Config->Circular & 1U) << DMA_SXCR_CIRC)
+                | ((uint32_t)Config->Direction << DMA_SXCR_DIR)
+                | ((uint32_t)(Config->PeriphFlowControl & 1U) << DMA_SXCR_PFCTRL)
+                | ((uint32_t)Config->Interrupts & DMA_SXCR_IT_MASK);
+
+        if (Config->FifoEnable != 0U)
+        {
+            Fifo = (1UL << DMA_SXFCR_DMDIS) | (DMA_SXFCR_FTH_FULL << DMA_SXFCR_FTH);
+        }
+        if ((Config->Interrupts & DMA_IT_FE) != 0U)
+        {
+            Fifo |= (1UL << DMA_SXFCR_FEIE);
+        }
+
+        DMAx->Stream[Stream].PAR = Config->PeriphAddress;
+        DMAx->Stream[Stream].FCR = Fifo;
+        DMAx->Stream[Stream].CR = Control;
+    }
+
+    return ErrorState;
+}
+
+/**
+ * @brief Arms and enables a configured stream for one transfer.
+ *
+ * @param[in] DMAx        DMA controller, DMA_1 or DMA_2.
+ * @param[in] Stream      Stream number 0-7.
+ * @param[in] MemAddress  Memory buffer address.
+ * @param[in] Count       Number of peripheral sized items.
+ */
+void DMA_StreamStart(DMA_RegDef_t* DMAx, uint8_t Stream, uint32_t MemAddress, uint16_t Count)
+{
+    DMA_Stream_RegDef_t* StreamReg = &DMAx->Stream[Stream];
+
+    DMA_ClearFlags(DMAx, Stream, DMA_FLAG_ALL);   /**< Stale flags would block the enable */
+
+    StreamReg->M0AR = MemAddress;
+    StreamReg->NDTR = Count;
+    StreamReg->CR |= (1UL << DMA_SXCR_EN);
+}
+
+/**
+ * @brief Disables a stream and waits until the hardware has stopped it.
+ *
+ * @param[in] DMAx    DMA controller, DMA_1 or DMA_2.
+ * @param[in] Stream  Stream number 0-7.
+ */
+void DMA_StreamStop(DMA_RegDef_t* DMAx, uint8_t Stream)
+{
+    DMAx->Stream[Stream].CR &= ~(1UL << DMA_SXCR_EN);
+
+    /* EN stays set until the current single/burst transfer has finished */
+    while ((DMAx->Stream[Stream].CR & (1UL << DMA_SXCR_EN)) != 0U)
+    {
+    }
+}
+
+/**
+ * @brief Reads the status flags of a stream.
+ *
+ * @param[in] DMAx    DMA controller, DMA_1 or DMA_2.
+ * @param[in] Stream  Stream number 0-7.
+ * @return uint32_t Combination of DMA_FLAG_x values.
+ */
+uint32_t DMA_GetFlags(DMA_RegDef_t* DMAx, uint8_t Stream)
+{
+    uint32_t Status = (Stream < 4U) ? DMAx->LISR : DMAx->HISR;
+
+    return (Status >> DMA_FlagShift[Stream & 3U]) & DMA_FLAG_ALL;
+}
+
+/**
+ * @brief Clears status flags of a stream.
+ *
+ * @param[in] DMAx    DMA controller, DMA_1 or DMA_2.
+ * @param[in] Stream  Stream number 0-7.
+ * @param[in] Flags   Combination of DMA_FLAG_x values to clear.
+ */
+void DMA_ClearFlags(DMA_RegDef_t* DMAx, uint8_t Stream, uint32_t Flags)
+{
+    uint32_t Mask = (Flags & DMA_FLAG_ALL) << DMA_FlagShift[Stream & 3U];
+
+    if (Stream < 4U)
+    {
+        DMAx->LIFCR = Mask;   /**< Write-1-to-clear, other streams are untouched */
+    }
+    else
+    {
+        DMAx->HIFCR = Mask;
+    }
+}
@@ -0,0 +1,380 @@
+/**
+ * @file DSPK_Program.c
+ * @brief Program for the Q15 signal processing kernels.
+ *
+ * This file provides the kernels in two forms: the reference loops, one 16 x 16 product
+ * per step, and on the Cortex-M4 the SIMD loops, which load two samples per 32-bit word
+ * and multiply both pairs with one SMLALD. The FIR history lives in front of the new
+ * block in the state buffer, so each output is a plain dot product over contiguous memory.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include <string.h>
+
+#include "../Inc/DSPK_Interface.h"
+#include "../Inc/DSPK_Private.h"
+#include "../../../LIB/CORE_Intrinsics.h"
+#include "../../../LIB/ErrType.h"
+
+static int16_t DSPK_Saturate(int64_t Acc, uint32_t Shift);
+static int64_t DSPK_DotRef(const int16_t* X, const int16_t* H, uint32_t Taps);
+static void DSPK_FirBlock(DSPK_FirQ15_t* Fir, const int16_t* In, int16_t* Out, uint32_t Count, uint32_t Factor,
+                          uint8_t Reference);
+#if DSPK_SIMD
+static uint32_t DSPK_Load2(const int16_t* Samples);
+static int64_t DSPK_DotSimd(const int16_t* X, const int16_t* H, uint32_t Taps);
+#endif
+
+/**
+ * @brief Sets up a FIR filter and clears its history.
+ */
+uint8_t DSPK_FirQ15Init(DSPK_FirQ15_t* Fir, const int16_t* Coeffs, uint16_t Taps, int16_t* State, uint16_t BlockMax)
+{
+    if ((Fir == 0) || (Coeffs == 0) || (State == 0))
+    {
+        return NULL_PTR_ERR;
+    }
+    if ((Taps == 0U) || (BlockMax == 0U))
+    {
+        return NOK;
+    }
+
+    Fir->Coeffs = Coeffs;
+    Fir->State = State;
+    Fir->Taps = Taps;
+    Fir->BlockMax = BlockMax;
+    (void)memset(State, 0, DSPK_FIR_STATE_SIZE(Taps, BlockMax) * sizeof(int16_t));
+
+    return OK;
+}
+
+/**
+ * @brief Filters a block of samples.
+ */
+void DSPK_FirQ15(DSPK_FirQ15_t* Fir, const int16_t* In, int16_t* Out, uint32_t Count)
+{
+    DSPK_FirBlock(Fir, In, Out, Count, 1U, 0U);
+}
+
+/**
+ * @brief Filters a block of samples, reference version.
+ */
+void DSPK_FirQ15Ref(DSPK_FirQ15_t* Fir, const int16_t* In, int16_t* Out, uint32_t Count)
+{
+    DSPK_FirBlock(Fir, In, Out, Count, 1U, 1U);
+}
+
+/**
+ * @brief Sets up a biquad cascade and clears its history.
+ */
+uint8_t DSPK_BiquadQ15Init(DSPK_BiquadQ15_t* Biquad, const int16_t* Coeffs, uint8_t Stages, int16_t* State, uint8_t PostShift)
+{
+    if ((Biquad == 0) || (Coeffs == 0) || (State == 0))
+    {
+        return NULL_PTR_ERR;
+    }
+    if ((Stages == 0U) || (PostShift > DSPK_MAX_POSTSHIFT))
+    {
+        return NOK;
+    }
+
+    Biquad->Coeffs = Coeffs;
+    Biquad->State = State;
+    Biquad->Stages = Stages;
+    Biquad->PostShift = PostShift;
+    (void)memset(State, 0, DSPK_BIQUAD_STATE_SIZE(Stages) * sizeof(int16_t));
+
+    return OK;
+}
+
+/**
+ * @brief Runs a block of samples through the cascade.
+ *
+ * Stage by stage over the whole block, so each stage's packed coefficient pairs and
+ * history stay in registers. The history is kept as x[n-1]:x[n-2] and y[n-1]:y[n-2]
+ * halfword pairs, each advanced with one shift.
+ */
+void DSPK_BiquadQ15(DSPK_BiquadQ15_t* Biquad, const int16_t* In, int16_t* Out, uint32_t Count)
+{
+#if DSPK_SIMD
+    const int16_t* Coeffs = 0;
+    int16_t* State = 0;
+    const int16_t* Source = In;
+    uint32_t Stage = 0U;
+    uint32_t Index = 0U;
+    uint32_t Shift = DSPK_Q15_SHIFT - Biquad->PostShift;
+    int32_t B0 = 0;
+    uint32_t B12 = 0U;
+    uint32_t A12 = 0U;
+    uint32_t X12 = 0U;
+    uint32_t Y12 = 0U;
+    int16_t X0 = 0;
+    int16_t Y0 = 0;
+    int64_t Acc = 0;
+
+    for (Stage = 0U; Stage < Biquad->Stages; Stage++)
+    {
+        Coeffs = &Biquad->Coeffs[DSPK_BIQUAD_COEFFS * Stage];
+        State = &Biquad->State[DSPK_BIQUAD_STATES * Stage];
+        B0 = Coeffs[0];
+        B12 = DSPK_PACK(Coeffs[1], Coeffs[2]);
+        A12 = DSPK_PACK(Coeffs[3], Coeffs[4]);
+        X12 = DSPK_PACK(State[0], State[1]);
+        Y12 = DSPK_PACK(State[2], State[3]);
+
+        for (Index = 0U; Index < Count; Index++)
+        {
+            X0 = Source[Index];
+            Acc = (int64_t)(B0 * X0);
+            Acc = CORE_SMLALD(X12, B12, Acc);
+            Acc = CORE_SMLALD(Y12, A12, Acc);
+            Y0 = DSPK_Saturate(Acc, Shift);
+            X12 = (X12 << 16) | (uint16_t)X0;
+            Y12 = (Y12 << 16) | (uint16_t)Y0;
+            Out[Index] = Y0;
+        }
+
+        State[0] = (int16_t)X12;
+        State[1] = (int16_t)(X12 >> 16);
+        State[2] = (int16_t)Y12;
+        State[3] = (int16_t)(Y12 >> 16);
+        Source = Out;
+    }
+#else
+    DSPK_BiquadQ15Ref(Biquad, In, Out, Count);
+#endif
+}
+
+/**
+ * @brief Runs a block of samples through the cascade, reference version.
+ */
+void DSPK_BiquadQ15Ref(DSPK_BiquadQ15_t* Biquad, const int16_t* In, int16_t* Out, uint32_t Count)
+{
+    const int16_t* Coeffs = 0;
+    int16_t* State = 0;
+    const int16_t* Source = In;
+    uint32_t Stage = 0U;
+    uint32_t Index = 0U;
+    uint32_t Shift = DSPK_Q15_SHIFT - Biquad->PostShift;
+    int16_t X1 = 0;
+    int16_t X2 = 0;
+    int16_t Y1 = 0;
+    int16_t Y2 = 0;
+    int16_t X0 = 0;
+    int16_t Y0 = 0;
+    int64_t Acc = 0;
+
+    for (Stage = 0U; Stage < Biquad->Stages; Stage++)
+    {
+        Coeffs = &Biquad->Coeffs[DSPK_BIQUAD_COEFFS * Stage];
+        State = &Biquad->State[DSPK_BIQUAD_STATES * Stage];
+        X1 = State[0];
+        X2 = State[1];
+        Y1 = State[2];
+        Y2 = State[3];
+
+        for (Index = 0U; Index < Count; Index++)
+        {
+            X0 = Source[Index];
+            Acc = ((int64_t)Coeffs[0] * X0) + ((int64_t)Coeffs[1] * X1) + ((int64_t)Coeffs[2] * X2) +
+                  ((int64_t)Coeffs[3] * Y1) + ((int64_t)Coeffs[4] * Y2);
+            Y0 = DSPK_Saturate(Acc, Shift);
+            X2 = X1;
+            X1 = X0;
+            Y2 = Y1;
+            Y1 = Y0;
+            Out[Index] = Y0;
+        }
+
+        State[0] = X1;
+        State[1] = X2;
+        State[2] = Y1;
+        State[3] = Y2;
+        Source = Out;
+    }
+}
+
+/**
+ * @brief Sets up a decimating FIR and clears its history.
+ */
+uint8_t DSPK_DecimQ15Init(DSPK_DecimQ15_t* Decim, const int16_t* Coeffs, uint16_t Taps, int16_t* State, uint16_t BlockMax,
+                          uint8_t Factor)
+{
+    if (Decim == 0)
+    {
+        return NULL_PTR_ERR;
+    }
+    if ((Factor == 0U) || ((BlockMax % Factor) != 0U))
+    {
+        return NOK;
+    }
+
+    Decim->Factor = Factor;
+
+    return DSPK_FirQ15Init(&Decim->Fir, Coeffs, Taps, State, BlockMax);
+}
+
+/**
+ * @brief Filters and decimates a block: only the kept outputs are computed.
+ */
+void DSPK_DecimQ15(DSPK_DecimQ15_t* Decim, const int16_t* In, int16_t* Out, uint32_t Count)
+{
+    DSPK_FirBlock(&Decim->Fir, In, Out, Count, Decim->Factor, 0U);
+}
+
+/**
+ * @brief Filters and decimates a block, reference version.
+ */
+void DSPK_DecimQ15Ref(DSPK_DecimQ15_t* Decim, const int16_t* In, int16_t* Out, uint32_t Count)
+{
+    DSPK_FirBlock(&Decim->Fir, In, Out, Count, Decim->Factor, 1U);
+}
+
+/**
+ * @brief Adds two blocks with Q15 saturation, two samples per QADD16.
+ */
+void DSPK_AddQ15(const int16_t* A, const int16_t* B, int16_t* Out, uint32_t Count)
+{
+#if DSPK_SIMD
+    uint32_t Index = 0U;
+    uint32_t Sum = 0U;
+
+    for (Index = 0U; (Index + 2U) <= Count; Index += 2U)
+    {
+        Sum = CORE_QADD16(DSPK_Load2(&A[Index]), DSPK_Load2(&B[Index]));
+        (void)memcpy(&Out[Index], &Sum, sizeof(Sum));
+    }
+    if (Index < Count)
+    {
+        Out[Index] = DSPK_Saturate((int64_t)A[Index] + B[Index], 0U);
+    }
+#else
+    DSPK_AddQ15Ref(A, B, Out, Count);
+#endif
+}
+
+/**
+ * @brief Adds two blocks with Q15 saturation, reference version.
+ */
+void DSPK_AddQ15Ref(const int16_t* A, const int16_t* B, int16_t* Out, uint32_t Count)
+{
+    uint32_t Index = 0U;
+
+    for (Index = 0U; Index < Count; Index++)
+    {
+        Out[Index] = DSPK_Saturate((int64_t)A[Index] + B[Index], 0U);
+    }
+}
+
+/**
+ * @brief Shifts an accumulator down to Q15 and saturates it (SSAT on the M4).
+ */
+static int16_t DSPK_Saturate(int64_t Acc, uint32_t Shift)
+{
+    int64_t Value = Acc >> Shift;
+
+    if (Value > INT16_MAX)
+    {
+        Value = INT16_MAX;
+    }
+    else if (Value < INT16_MIN)
+    {
+        Value = INT16_MIN;
+    }
+    else
+    {
+        /* In range */
+    }
+
+    return (int16_t)Value;
+}
+
+/**
+ * @brief Dot product of two sample runs, one product per step.
+ */
+static int64_t DSPK_DotRef(const int16_t* X, const int16_t* H, uint32_t Taps)
+{
+    int64_t Acc = 0;
+    uint32_t Index = 0U;
+
+    for (Index = 0U; Index < Taps; Index++)
+    {
+        Acc += (int32_t)X[Index] * H[Index];
+    }
+
+    return Acc;
+}
+
+/**
+ * @brief Runs the FIR over a block, keeping the output at the last input of every Factor.
+ *
+ * The block is appended to the history first, which also makes Out == In safe, and the
+ * newest Taps - 1 samples are moved to the front afterwards.
+ */
+static void DSPK_FirBlock(DSPK_FirQ15_t* Fir, const int16_t* In, int16_t* Out, uint32_t Count, uint32_t Factor,
+                          uint8_t Reference)
+{
+    uint32_t History = (uint32_t)Fir->Taps - 1U;
+    uint32_t Index = 0U;
+    uint32_t Kept = 0U;
+    int64_t Acc = 0;
+
+    if (Count > Fir->BlockMax)
+    {
+        Count = Fir->BlockMax;
+    }
+
+    (void)memcpy(&Fir->State[History], In, Count * sizeof(int16_t));
+
+    for (Index = Factor - 1U; Index < Count; Index += Factor)
+    {
+#if DSPK_SIMD
+        Acc = (Reference != 0U) ? DSPK_DotRef(&Fir->State[Index], Fir->Coeffs, Fir->Taps)
+                                : DSPK_DotSimd(&Fir->State[Index], Fir->Coeffs, Fir->Taps);
+#else
+        (void)Reference;
+        Acc = DSPK_DotRef(&Fir->State[Index], Fir->Coeffs, Fir->Taps);
+#endif
+        Out[Kept] = DSPK_Saturate(Acc, DSPK_Q15_SHIFT);
+        Kept++;
+    }
+
+    (void)memmove(Fir->State, &Fir->State[Count], History * sizeof(int16_t));
+}
+
+#if DSPK_SIMD
+/**
+ * @brief Loads two adjacent samples as one word (unaligned LDR on the M4).
+ */
+static uint32_t DSPK_Load2(const int16_t* Samples)
+{
+    uint32_t Word = 0U;
+
+    (void)memcpy(&Word, Samples, sizeof(Word));
+
+    return Word;
+}
+
+/**
+ * @brief Dot product of two sample runs, four products per iteration in two SMLALDs.
+ */
+static int64_t DSPK_DotSimd(const int16_t* X, const int16_t* H, uint32_t Taps)
+{
+    int64_t Acc = 0;
+    uint32_t Index = 0U;
+
+    for (Index = 0U; (Index + 4U) <= Taps; Index += 4U)
+    {
+        Acc = CORE_SMLALD(DSPK_Load2(&X[Index]), DSPK_Load2(&H[Index]), Acc);
+        Acc = CORE_SMLALD(DSPK_Load2(&X[Index + 2U]), DSPK_Load2(&H[Index + 2U]), Acc);
+    }
+    for (; Index < Taps; Index++)
+    {
+        Acc += (int32_t)X[Index] * H[Index];
+    }
+
+    return Acc;
+}
+#endif
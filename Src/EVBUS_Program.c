@@ -0,0 +1,223 @@
+/**
+ * @file EVBUS_Program.c
+ * @brief Program for the interrupt-level publish/subscribe event bus.
+ *
+ * This file keeps, per priority level, the bitmap of topics pending there. Publishers OR
+ * into it with LDREX/STREX and the level's dispatch IRQ takes it whole by swapping in
+ * zero, so neither side masks interrupts. The fan-out of each topic over the levels and
+ * the subscribers of each level are computed once at EVBUS_Init(), with the level each
+ * dispatch IRQ serves, so a later change of the IRQ priorities does not move the bitmaps.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/EVBUS_Interface.h"
+#include "../Inc/EVBUS_Private.h"
+#include "../Inc/NVIC_Interface.h"
+#include "../../../LIB/CORE_Intrinsics.h"
+#include "../../../LIB/ErrType.h"
+
+static const EVBUS_Config_t* EVBUS_Config = 0;
+static volatile uint32_t EVBUS_Pending[EVBUS_LEVELS];        /**< Topics pending per level */
+static uint16_t EVBUS_TopicLevels[EVBUS_MAX_TOPICS];         /**< Levels having subscribers of each topic */
+static uint32_t EVBUS_LevelSubscribers[EVBUS_LEVELS];        /**< Subscribers running at each level */
+static uint8_t EVBUS_IrqLevel[NVIC_IRQ_COUNT];               /**< Level dispatched by each IRQ, EVBUS_NO_LEVEL if none */
+
+static uint8_t EVBUS_Validate(const EVBUS_Config_t* Config);
+
+/**
+ * @brief Checks the configuration and sets up the dispatch IRQs.
+ *
+ * The whole configuration is checked before any state or NVIC register is written, so a
+ * rejected configuration leaves a running bus as it was.
+ */
+uint8_t EVBUS_Init(const EVBUS_Config_t* Config)
+{
+    const EVBUS_Subscriber_t* Subscriber = 0;
+    uint32_t Index = 0U;
+    uint32_t Topic = 0U;
+
+    if ((Config == 0) || (Config->Subscribers == 0) || (Config->Topics == 0))
+    {
+        return NULL_PTR_ERR;
+    }
+    if (EVBUS_Validate(Config) != OK)
+    {
+        return NOK;
+    }
+
+    for (Index = 0U; Index < NVIC_IRQ_COUNT; Index++)
+    {
+        EVBUS_IrqLevel[Index] = EVBUS_NO_LEVEL;
+    }
+    for (Index = 0U; Index < EVBUS_LEVELS; Index++)
+    {
+        if (Config->LevelIrq[Index] != EVBUS_NO_IRQ)
+        {
+            EVBUS_IrqLevel[Config->LevelIrq[Index]] = (uint8_t)Index;
+        }
+    }
+
+    for (Index = 0U; Index < EVBUS_LEVELS; Index++)
+    {
+        EVBUS_LevelSubscribers[Index] = 0U;
+        EVBUS_Pending[Index] = 0U;
+    }
+    for (Index = 0U; Index < Config->SubscriberCount; Index++)
+    {
+        Subscriber = &Config->Subscribers[Index];
+        EVBUS_LevelSubscribers[Subscriber->Level] |= (1UL << Index);
+    }
+
+    for (Topic = 0U; Topic < Config->TopicCount; Topic++)
+    {
+        EVBUS_TopicLevels[Topic] = 0U;
+        for (Index = 0U; Index < EVBUS_LEVELS; Index++)
+        {
+            if ((Config->Topics[Topic] & EVBUS_LevelSubscribers[Index]) != 0U)
+            {
+                EVBUS_TopicLevels[Topic] |= (uint16_t)(1U << Index);
+            }
+        }
+    }
+
+    EVBUS_Config = Config;
+
+    for (Index = 0U; Index < EVBUS_LEVELS; Index++)
+    {
+        if (EVBUS_LevelSubscribers[Index] != 0U)
+        {
+            NVIC_SetPriority((IRQn_Type)Config->LevelIrq[Index], Index);
+            NVIC_EnableIRQClean((IRQn_Type)Config->LevelIrq[Index]);
+        }
+    }
+
+    return OK;
+}
+
+/**
+ * @brief Checks the counts, the dispatch IRQs and every subscriber of a configuration.
+ */
+static uint8_t EVBUS_Validate(const EVBUS_Config_t* Config)
+{
+    const EVBUS_Subscriber_t* Subscriber = 0;
+    uint32_t Used[NVIC_IRQ_WORDS] = { 0U };   /**< Dispatch IRQs already given to a level */
+    uint32_t Index = 0U;
+    uint8_t IRQn = 0U;
+
+    if ((Config->SubscriberCount > EVBUS_MAX_SUBSCRIBERS) || (Config->TopicCount > EVBUS_MAX_TOPICS))
+    {
+        return NOK;
+    }
+
+    for (Index = 0U; Index < EVBUS_LEVELS; Index++)
+    {
+        IRQn = Config->LevelIrq[Index];
+        if (IRQn == EVBUS_NO_IRQ)
+        {
+            continue;
+        }
+        if ((IRQn >= NVIC_IRQ_COUNT) || ((Used[IRQn / 32U] & (1UL << (IRQn % 32U))) != 0U))
+        {
+            return NOK;
+        }
+        Used[IRQn / 32U] |= (1UL << (IRQn % 32U));
+    }
+
+    for (Index = 0U; Index < Config->SubscriberCount; Index++)
+    {
+        Subscriber = &Config->Subscribers[Index];
+        if ((Subscriber->Level >= EVBUS_LEVELS) || (Config->LevelIrq[Subscriber->Level] == EVBUS_NO_IRQ) ||
+            (Subscriber->Handler == 0))
+        {
+            return NOK;
+        }
+    }
+
+    return OK;
+}
+
+/**
+ * @brief Publishes a topic.
+ *
+ * Only the publisher that turns a level's bitmap from empty to non-empty pends the
+ * level's IRQ; later publishers see a non-empty bitmap and know a delivery is coming.
+ */
+uint8_t EVBUS_Publish(uint8_t Topic)
+{
+    uint32_t Levels = 0U;
+    uint32_t Level = 0U;
+
+    if ((EVBUS_Config == 0) || (Topic >= EVBUS_Config->TopicCount))
+    {
+        return NOK;
+    }
+
+    Levels = EVBUS_TopicLevels[Topic];
+    while (Levels != 0U)
+    {
+        Level = 31U - CORE_CLZ(Levels);
+        Levels &= ~(1UL << Level);
+
+        if (CORE_AtomicFetchOr(&EVBUS_Pending[Level], 1UL << Topic) == 0U)
+        {
+            NVIC_SetPendingIRQ((IRQn_Type)EVBUS_Config->LevelIrq[Level]);
+        }
+    }
+
+    return OK;
+}
+
+/**
+ * @brief Dispatch IRQ handler: the running IRQ serves the level it was given at EVBUS_Init().
+ *
+ * The level is not read back from the IRQ priority: once re-prioritised (e.g. by
+ * PRIOPROF_Apply()), the IRQ would drain another level and its own topics would stay
+ * pending with nothing left to pend it again.
+ */
+void EVBUS_Dispatch(void)
+{
+    uint32_t IRQn = CORE_GetIPSR() - EVBUS_EXCEPTION_OFFSET;
+
+    if ((IRQn < NVIC_IRQ_COUNT) && (EVBUS_IrqLevel[IRQn] != EVBUS_NO_LEVEL))
+    {
+        EVBUS_DispatchLevel(EVBUS_IrqLevel[IRQn]);
+    }
+}
+
+/**
+ * @brief Delivers the topics pending at a level.
+ *
+ * The bitmap is swapped for zero before the delivery, so a publish made meanwhile pends
+ * the IRQ again and is delivered in its next run.
+ */
+void EVBUS_DispatchLevel(uint8_t Level)
+{
+    const EVBUS_Subscriber_t* Subscriber = 0;
+    uint32_t Topics = 0U;
+    uint32_t Topic = 0U;
+    uint32_t Subscribers = 0U;
+    uint32_t Index = 0U;
+
+    if ((EVBUS_Config == 0) || (Level >= EVBUS_LEVELS))
+    {
+        return;
+    }
+
+    Topics = CORE_AtomicSwap(&EVBUS_Pending[Level], 0U);
+    while (Topics != 0U)
+    {
+        Topic = 31U - CORE_CLZ(Topics);
+        Topics &= ~(1UL << Topic);
+
+        Subscribers = EVBUS_Config->Topics[Topic] & EVBUS_LevelSubscribers[Level];
+        while (Subscribers != 0U)
+        {
+            Index = 31U - CORE_CLZ(Subscribers);
+            Subscribers &= ~(1UL << Index);
+            Subscriber = &EVBUS_Config->Subscribers[Index];
+            Subscriber->Handler((uint8_t)Topic, Subscriber->Context);
+        }
+    }
+}
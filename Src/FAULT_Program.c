@@ -0,0 +1,157 @@
+/**
+ * @file FAULT_Program.c
+ * @brief Program for the fault handlers that capture a crash record with NVIC state.
+ *
+ * This file provides the HardFault, MemManage, BusFault and UsageFault handlers and the
+ * capture routine that fills the retained crash record. The capture is straight-line
+ * register copies (about fifty words), well within a few hundred cycles.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/FAULT_Interface.h"
+#include "../Inc/FAULT_Private.h"
+#include "../Inc/NVIC_Interface.h"
+#include "../../../LIB/STM32F446xx.h"
+#include "../../../LIB/CORE_Intrinsics.h"
+#include "../../../LIB/ErrType.h"
+
+static FAULT_Record_t FAULT_Record FAULT_RETAINED;   /**< Survives the reset that follows the fault */
+
+static uint32_t FAULT_Checksum(const FAULT_Record_t* Record);
+
+/**
+ * @brief Enables the MemManage, BusFault and UsageFault handlers.
+ */
+void FAULT_Init(void)
+{
+    SCB->SHCSR |= (1UL << FAULT_SHCSR_MEMFAULTENA) | (1UL << FAULT_SHCSR_BUSFAULTENA) |
+                  (1UL << FAULT_SHCSR_USGFAULTENA);
+}
+
+/**
+ * @brief Retrieves the crash record of the previous run.
+ *
+ * @param[out] Record  Copy of the record.
+ * @return uint8_t OK when an intact record exists, NOK otherwise, NULL_PTR_ERR on a NULL argument.
+ */
+uint8_t FAULT_GetRecord(FAULT_Record_t* Record)
+{
+    if (Record == 0)
+    {
+        return NULL_PTR_ERR;
+    }
+    if ((FAULT_Record.Magic != FAULT_RECORD_MAGIC) || (FAULT_Record.Checksum != FAULT_Checksum(&FAULT_Record)))
+    {
+        return NOK;
+    }
+
+    *Record = FAULT_Record;
+
+    return OK;
+}
+
+/**
+ * @brief Invalidates the crash record.
+ */
+void FAULT_ClearRecord(void)
+{
+    FAULT_Record.Magic = 0U;
+}
+
+/**
+ * @brief Fault capture, entered from the fault handlers with the stacked frame address.
+ *
+ * The frame is only read when the stack pointer lies inside SRAM: a fault raised while
+ * stacking leaves a pointer that would fault again and lock the core up.
+ *
+ * @param[in] Frame      Stacked exception frame (MSP or PSP at fault entry).
+ * @param[in] ExcReturn  EXC_RETURN value of the fault handler.
+ */
+__attribute__((used, noreturn)) void FAULT_Capture(uint32_t* Frame, uint32_t ExcReturn)
+{
+    uint32_t Index = 0U;
+    uint32_t Address = (uint32_t)Frame;
+
+    FAULT_Record.Magic = 0U;
+    FAULT_Record.Exception = CORE_GetIPSR();
+    FAULT_Record.ExcReturn = ExcReturn;
+    FAULT_Record.StackPointer = Address;
+    FAULT_Record.BasePri = CORE_GetBASEPRI();
+
+    FAULT_Record.FrameValid = (uint32_t)(((Address & 3U) == 0U) && (Address >= SRAM_BASE_ADDRESS) &&
+                                         (Address <= (SRAM_BASE_ADDRESS + SRAM_SIZE - (FAULT_FRAME_WORDS * 4U))));
+    for (Index = 0U; Index < FAULT_FRAME_WORDS; Index++)
+    {
+        FAULT_Record.Frame[Index] = (FAULT_Record.FrameValid != 0U) ? Frame[Index] : 0U;
+    }
+
+    FAULT_Record.Cfsr = SCB->CFSR;
+    FAULT_Record.Hfsr = SCB->HFSR;
+    FAULT_Record.Mmfar = SCB->MMFAR;
+    FAULT_Record.Bfar = SCB->BFAR;
+    FAULT_Record.Shcsr = SCB->SHCSR;
+
+    for (Index = 0U; Index < NVIC_IRQ_WORDS; Index++)
+    {
+        FAULT_Record.Active[Index] = NVIC->IABR[Index];
+        FAULT_Record.Pending[Index] = NVIC->ISPR[Index];
+    }
+
+    FAULT_Record.Checksum = FAULT_Checksum(&FAULT_Record);
+    FAULT_Record.Magic = FAULT_RECORD_MAGIC;   /**< Written last: a partial record is never valid */
+
+    CORE_DSB();
+
+    if ((COREDEBUG->DHCSR & (1UL << FAULT_DHCSR_C_DEBUGEN)) != 0U)
+    {
+        __asm volatile ("BKPT #0");
+    }
+
+    SCB->AIRCR = SCB_AIRCR_VECTKEY | (1UL << SCB_AIRCR_SYSRESETREQ);
+    CORE_DSB();
+
+    for (;;)
+    {
+        /* Wait for the reset */
+    }
+}
+
+__attribute__((naked)) void HardFault_Handler(void)
+{
+    FAULT_HANDLER_BODY();
+}
+
+__attribute__((naked)) void MemManage_Handler(void)
+{
+    FAULT_HANDLER_BODY();
+}
+
+__attribute__((naked)) void BusFault_Handler(void)
+{
+    FAULT_HANDLER_BODY();
+}
+
+__attribute__((naked)) void UsageFault_Handler(void)
+{
+    FAULT_HANDLER_BODY();
+}
+
+/**
+ * @brief Sums every word of the record before Checksum, the magic included.
+ */
+static uint32_t FAULT_Checksum(const FAULT_Record_t* Record)
+{
+    const uint32_t* Words = &Record->Exception;
+    uint32_t WordCount = (uint32_t)((sizeof(FAULT_Record_t) / 4U) - 2U);
+    uint32_t Sum = FAULT_RECORD_MAGIC;
+    uint32_t Index = 0U;
+
+    for (Index = 0U; Index < WordCount; Index++)
+    {
+        Sum += Words[Index];
+    }
+
+    return Sum;
+}
@@ -0,0 +1,329 @@
+/**
+ * @file HSM_Program.c
+ * @brief Program for the table-driven hierarchical state machines.
+ *
+ * This file resolves the transitions at initialisation and runs them from the table.
+ * Every walk of the hierarchy at run time stops at a precomputed state, so the cost of
+ * an event only depends on the nesting depth of the states involved.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/HSM_Interface.h"
+#include "../Inc/HSM_Private.h"
+#include "../Inc/NVIC_Interface.h"
+#include "../../../LIB/CORE_Intrinsics.h"
+#include "../../../LIB/ErrType.h"
+
+static uint8_t HSM_Validate(const HSM_Definition_t* Definition);
+static uint8_t HSM_Lca(const HSM_Definition_t* Definition, uint8_t Source, uint8_t Target);
+static void HSM_Exit(HSM_Machine_t* Machine, uint8_t Lca);
+static void HSM_Enter(HSM_Machine_t* Machine, uint8_t Lca, uint8_t Target);
+
+/**
+ * @brief Resolves the transition table and enters the initial state.
+ *
+ * For each state the first transition found on the state itself, then on its parent and
+ * so on, handles the event: substates inherit the transitions of their ancestors.
+ */
+uint8_t HSM_Init(HSM_Machine_t* Machine, const HSM_Definition_t* Definition, HSM_Cell_t* Table, uint8_t* Queue,
+                 uint16_t QueueSize, void* Context)
+{
+    const HSM_TransitionDef_t* Transition = 0;
+    HSM_Cell_t* Cell = 0;
+    uint32_t State = 0U;
+    uint32_t Event = 0U;
+    uint32_t Index = 0U;
+    uint8_t Source = 0U;
+
+    if ((Machine == 0) || (Definition == 0) || (Table == 0) || (Queue == 0) || (Definition->States == 0) ||
+        ((Definition->Transitions == 0) && (Definition->TransitionCount != 0U)))
+    {
+        return NULL_PTR_ERR;
+    }
+    if ((QueueSize == 0U) || ((QueueSize & (QueueSize - 1U)) != 0U) || (HSM_Validate(Definition) != OK))
+    {
+        return NOK;
+    }
+
+    Machine->Definition = Definition;
+    Machine->Table = Table;
+    Machine->Queue = Queue;
+    Machine->QueueMask = (uint16_t)(QueueSize - 1U);
+    Machine->Head = 0U;
+    Machine->Tail = 0U;
+    Machine->Dropped = 0U;
+    Machine->Context = Context;
+    Machine->Bound = 0U;
+
+    for (State = 0U; State < Definition->StateCount; State++)
+    {
+        for (Event = 0U; Event < Definition->EventCount; Event++)
+        {
+            Cell = &HSM_CELL(Machine, State, Event);
+            Cell->Transition = HSM_NONE;
+            Cell->Lca = HSM_NONE;
+
+            for (Source = (uint8_t)State; (Source != HSM_NONE) && (Cell->Transition == HSM_NONE);
+                 Source = Definition->States[Source].Parent)
+            {
+                for (Index = 0U; Index < Definition->TransitionCount; Index++)
+                {
+                    Transition = &Definition->Transitions[Index];
+                    if ((Transition->Source == Source) && (Transition->Event == Event))
+                    {
+                        Cell->Transition = (uint8_t)Index;
+                        Cell->Lca = (Transition->Target == HSM_NONE) ? HSM_NONE
+                                                                     : HSM_Lca(Definition, Source, Transition->Target);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    Machine->Current = HSM_NONE;
+    HSM_Enter(Machine, HSM_NONE, Definition->Initial);
+
+    return OK;
+}
+
+/**
+ * @brief Binds the machine to an IRQ at the given priority.
+ *
+ * Events posted before the binding are run as soon as it is made.
+ */
+void HSM_Bind(HSM_Machine_t* Machine, IRQn_Type IRQn, uint32_t Priority)
+{
+    Machine->IRQn = IRQn;
+    NVIC_SetPriority(IRQn, Priority);
+    NVIC_EnableIRQClean(IRQn);
+    Machine->Bound = 1U;
+
+    if (Machine->Head != Machine->Tail)
+    {
+        NVIC_SetPendingIRQ(IRQn);
+    }
+}
+
+/**
+ * @brief Queues an event and pends the machine's IRQ.
+ *
+ * The slot is claimed with interrupts masked for a few instructions, since producers
+ * may preempt each other. The IRQ is pended for every event: pending an IRQ that is
+ * already pending costs nothing more.
+ */
+uint8_t HSM_Post(HSM_Machine_t* Machine, uint8_t Event)
+{
+    uint32_t State = 0U;
+
+    if (Event >= Machine->Definition->EventCount)
+    {
+        return NOK;
+    }
+
+    State = CORE_EnterCritical();
+    if ((uint16_t)(Machine->Head - Machine->Tail) > Machine->QueueMask)
+    {
+        Machine->Dropped++;
+        CORE_ExitCritical(State);
+        return NOK;
+    }
+    Machine->Queue[Machine->Head & Machine->QueueMask] = Event;
+    Machine->Head++;
+    CORE_ExitCritical(State);
+
+    if (Machine->Bound != 0U)
+    {
+        NVIC_SetPendingIRQ(Machine->IRQn);
+    }
+
+    return OK;
+}
+
+/**
+ * @brief Runs every queued event to completion.
+ *
+ * The IRQ is the only consumer, so the tail is moved without a lock, once the event has
+ * been read out of its slot.
+ */
+void HSM_Dispatch(void* Machine)
+{
+    HSM_Machine_t* Hsm = (HSM_Machine_t*)Machine;
+    uint8_t Event = 0U;
+
+    while (Hsm->Tail != Hsm->Head)
+    {
+        Event = Hsm->Queue[Hsm->Tail & Hsm->QueueMask];
+        Hsm->Tail++;
+        HSM_Handle(Hsm, Event);
+    }
+}
+
+/**
+ * @brief Runs one event to completion right away.
+ */
+void HSM_Handle(HSM_Machine_t* Machine, uint8_t Event)
+{
+    const HSM_Cell_t* Cell = 0;
+    const HSM_TransitionDef_t* Transition = 0;
+
+    if (Event >= Machine->Definition->EventCount)
+    {
+        return;
+    }
+
+    Cell = &HSM_CELL(Machine, Machine->Current, Event);
+    if (Cell->Transition == HSM_NONE)
+    {
+        return;
+    }
+    Transition = &Machine->Definition->Transitions[Cell->Transition];
+
+    if (Transition->Target == HSM_NONE)
+    {
+        if (Transition->Action != 0)
+        {
+            Transition->Action(Machine->Context);
+        }
+        return;
+    }
+
+    HSM_Exit(Machine, Cell->Lca);
+    if (Transition->Action != 0)
+    {
+        Transition->Action(Machine->Context);
+    }
+    HSM_Enter(Machine, Cell->Lca, Transition->Target);
+}
+
+/**
+ * @brief Checks every index of a definition and the depth of every state.
+ */
+static uint8_t HSM_Validate(const HSM_Definition_t* Definition)
+{
+    const HSM_StateDef_t* States = Definition->States;
+    const HSM_TransitionDef_t* Transition = 0;
+    uint32_t Index = 0U;
+    uint32_t Depth = 0U;
+    uint8_t State = 0U;
+
+    if ((Definition->StateCount == 0U) || (Definition->StateCount == HSM_NONE) ||
+        (Definition->Initial >= Definition->StateCount))
+    {
+        return NOK;
+    }
+
+    for (Index = 0U; Index < Definition->StateCount; Index++)
+    {
+        if ((States[Index].Initial != HSM_NONE) &&
+            ((States[Index].Initial >= Definition->StateCount) || (States[States[Index].Initial].Parent != Index)))
+        {
+            return NOK;
+        }
+
+        /* A cycle shows up as a depth over the limit */
+        Depth = 0U;
+        for (State = (uint8_t)Index; State != HSM_NONE; State = States[State].Parent)
+        {
+            if ((State >= Definition->StateCount) || (Depth == HSM_MAX_DEPTH))
+            {
+                return NOK;
+            }
+            Depth++;
+        }
+    }
+
+    for (Index = 0U; Index < Definition->TransitionCount; Index++)
+    {
+        Transition = &Definition->Transitions[Index];
+        if ((Transition->Source >= Definition->StateCount) || (Transition->Event >= Definition->EventCount) ||
+            ((Transition->Target != HSM_NONE) && (Transition->Target >= Definition->StateCount)))
+        {
+            return NOK;
+        }
+    }
+
+    return OK;
+}
+
+/**
+ * @brief Returns the deepest state that is a proper ancestor of both source and target.
+ *
+ * Excluding the states themselves makes every transition external: a transition to the
+ * source itself or to one of its substates exits and re-enters the source.
+ */
+static uint8_t HSM_Lca(const HSM_Definition_t* Definition, uint8_t Source, uint8_t Target)
+{
+    uint8_t Ancestor = 0U;
+    uint8_t State = 0U;
+
+    for (Ancestor = Definition->States[Source].Parent; Ancestor != HSM_NONE;
+         Ancestor = Definition->States[Ancestor].Parent)
+    {
+        for (State = Definition->States[Target].Parent; State != HSM_NONE; State = Definition->States[State].Parent)
+        {
+            if (State == Ancestor)
+            {
+                return Ancestor;
+            }
+        }
+    }
+
+    return HSM_NONE;
+}
+
+/**
+ * @brief Runs the exit actions from the current leaf up to, not including, Lca.
+ */
+static void HSM_Exit(HSM_Machine_t* Machine, uint8_t Lca)
+{
+    const HSM_StateDef_t* States = Machine->Definition->States;
+    uint8_t State = 0U;
+
+    for (State = Machine->Current; State != Lca; State = States[State].Parent)
+    {
+        if (States[State].Exit != 0)
+        {
+            States[State].Exit(Machine->Context);
+        }
+    }
+}
+
+/**
+ * @brief Runs the entry actions from below Lca down to Target, then down its initial substates.
+ */
+static void HSM_Enter(HSM_Machine_t* Machine, uint8_t Lca, uint8_t Target)
+{
+    const HSM_StateDef_t* States = Machine->Definition->States;
+    uint8_t Path[HSM_MAX_DEPTH];
+    uint32_t Length = 0U;
+    uint8_t State = 0U;
+
+    for (State = Target; State != Lca; State = States[State].Parent)
+    {
+        Path[Length] = State;
+        Length++;
+    }
+    while (Length != 0U)
+    {
+        Length--;
+        if (States[Path[Length]].Entry != 0)
+        {
+            States[Path[Length]].Entry(Machine->Context);
+        }
+    }
+
+    State = Target;
+    while (States[State].Initial != HSM_NONE)
+    {
+        State = States[State].Initial;
+        if (States[State].Entry != 0)
+        {
+            States[State].Entry(Machine->Context);
+        }
+    }
+
+    Machine->Current = State;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file IDLE_Program.c
+ * @brief Program for the background job scheduler run from the idle loop.
+ *
+ * This file keeps the ready jobs as bits of one word: IDLE_Request() sets a job's bit
+ * with an LDREX/STREX fetch-or, IDLE_Poll() clears it with PRIMASK set before running
+ * the step and sets it again when the step reports more work. A request made during the
+ * step is therefore never lost.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/IDLE_Interface.h"
+#include "../Inc/NVIC_Interface.h"
+#include "../../../LIB/STM32F446xx.h"
+#include "../../../LIB/CORE_Intrinsics.h"
+#include "../../../LIB/ErrType.h"
+
+static IDLE_Job_t* IDLE_Jobs[IDLE_MAX_JOBS];
+static uint8_t IDLE_JobCount = 0U;
+static volatile uint32_t IDLE_Ready = 0U;     /**< Bit n set while job n is ready */
+static uint8_t IDLE_Last = 0U;                /**< Job whose step ran last */
+static const IDLE_Job_t* IDLE_Current = 0;    /**< Job whose step is running */
+static uint32_t IDLE_StepStart = 0U;          /**< CYCCNT at the start of that step */
+
+/**
+ * @brief Registers a job.
+ */
+uint8_t IDLE_Register(IDLE_Job_t* Job)
+{
+    if ((Job == 0) || (Job->Step == 0))
+    {
+        return NULL_PTR_ERR;
+    }
+    if ((IDLE_JobCount >= IDLE_MAX_JOBS) || (Job->BudgetCycles == 0U))
+    {
+        return NOK;
+    }
+
+    COREDEBUG->DEMCR |= (1UL << COREDEBUG_DEMCR_TRCENA);
+    DWT->CTRL |= (1UL << DWT_CTRL_CYCCNTENA);
+
+    Job->MaxCycles = 0U;
+    Job->Overruns = 0U;
+    Job->Index = IDLE_JobCount;
+    IDLE_Jobs[IDLE_JobCount] = Job;
+    IDLE_JobCount++;
+
+    return OK;
+}
+
+/**
+ * @brief Makes a job ready.
+ */
+void IDLE_Request(const IDLE_Job_t* Job)
+{
+    (void)CORE_AtomicFetchOr(&IDLE_Ready, 1UL << Job->Index);
+}
+
+/**
+ * @brief Runs one step of the next ready job, or sleeps.
+ *
+ * Jobs take turns in descending index order: the next job is the highest ready index
+ * below the last one run, wrapping to the highest ready index.
+ */
+void IDLE_Poll(void)
+{
+    IDLE_Job_t* Job = 0;
+    uint32_t Ready = 0U;
+    uint32_t Index = 0U;
+    uint32_t Cycles = 0U;
+    IDLE_StepResult_t Result = IDLE_STEP_DONE;
+
+    CORE_DisableIRQ();
+    if (NVIC_GetHighestPending() != NVIC_NO_PENDING)
+    {
+        CORE_EnableIRQ();   /**< The pending exception is taken here */
+        return;
+    }
+
+    Ready = IDLE_Ready;
+    if (Ready == 0U)
+    {
+        CORE_DSB();
+        CORE_WFI();
+        CORE_EnableIRQ();   /**< The waking interrupt is taken here */
+        return;
+    }
+
+    Index = Ready & ((1UL << IDLE_Last) - 1U);
+    Index = 31U - CORE_CLZ((Index != 0U) ? Index : Ready);
+    IDLE_Ready = Ready & ~(1UL << Index);   /**< No ISR can run between the read and this write */
+    CORE_EnableIRQ();
+
+    Job = IDLE_Jobs[Index];
+    IDLE_Last = (uint8_t)Index;
+    IDLE_Current = Job;
+    IDLE_StepStart = DWT->CYCCNT;
+    Result = Job->Step(Job->Context);
+    Cycles = DWT->CYCCNT - IDLE_StepStart;
+    IDLE_Current = 0;
+
+    if (Cycles > Job->MaxCycles)
+    {
+        Job->MaxCycles = Cycles;
+    }
+    if (Cycles > Job->BudgetCycles)
+    {
+        Job->Overruns++;
+    }
+    if (Result == IDLE_STEP_MORE)
+    {
+        (void)CORE_AtomicFetchOr(&IDLE_Ready, 1UL << Index);
+    }
+}
+
+/**
+ * @brief Reports whether the running step should return now.
+ *
+ * The budget counts the cycles spent in interrupts that preempted the step too: the
+ * step has held the idle loop that long.
+ */
+uint8_t IDLE_ShouldYield(void)
+{
+    if (IDLE_Current == 0)
+    {
+        return 1U;
+    }
+    if ((DWT->CYCCNT - IDLE_StepStart) >= IDLE_Current->BudgetCycles)
+    {
+        return 1U;
+    }
+
+    return (NVIC_GetHighestPending() != NVIC_NO_PENDING) ? 1U : 0U;
+}
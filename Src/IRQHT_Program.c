@@ -0,0 +1,123 @@
+/**
+ * @file IRQHT_Program.c
+ * @brief Program for the runtime interrupt handler table.
+ *
+ * This file provides the dispatcher and the read-copy-update style replacement of the
+ * bindings. Readers are the handler entries: each loads its binding once, so an entry
+ * runs either the old or the new binding, never a mix. A reader only lasts while its IRQ
+ * is active, so the grace period of a binding ends when the IRQ is seen inactive after
+ * the binding was unpublished.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/IRQHT_Interface.h"
+#include "../Inc/IRQHT_Private.h"
+#include "../Inc/NVIC_Interface.h"
+#include "../../../LIB/CORE_Intrinsics.h"
+#include "../../../LIB/ErrType.h"
+
+static IRQHT_Binding_t* volatile IRQHT_Table[NVIC_IRQ_COUNT];   /**< Published bindings */
+static IRQHT_Binding_t* IRQHT_Retired[NVIC_IRQ_COUNT];          /**< Unpublished bindings still in their grace period */
+
+/**
+ * @brief Vector table entry of the managed IRQs: runs the handler bound to the current IRQ.
+ */
+void IRQHT_Dispatch(void)
+{
+    uint32_t IRQn = CORE_GetIPSR() - IRQHT_EXCEPTION_OFFSET;
+    IRQHT_Binding_t* Binding = 0;
+
+    if (IRQn >= NVIC_IRQ_COUNT)
+    {
+        return;
+    }
+
+    Binding = IRQHT_Table[IRQn];   /**< The single read of this entry */
+    if (Binding != 0)
+    {
+        Binding->Handler(Binding->Context);
+    }
+}
+
+/**
+ * @brief Publishes a new binding for an IRQ, without masking it.
+ *
+ * The DMB makes the new binding's fields visible before its pointer. The DSB completes
+ * the store, so an entry taken after it reads the new pointer; an entry taken before it
+ * has either returned or is still active. While the caller runs, an active instance can
+ * only be nested beneath it, so it cannot be waited for here and its binding is retired.
+ */
+uint8_t IRQHT_Replace(IRQn_Type IRQn, IRQHT_Binding_t* New, IRQHT_Binding_t** Old)
+{
+    IRQHT_Binding_t* Previous = 0;
+
+    if (Old == 0)
+    {
+        return NULL_PTR_ERR;
+    }
+    if ((uint32_t)IRQn >= NVIC_IRQ_COUNT)
+    {
+        return NOK;
+    }
+
+    Previous = IRQHT_Table[IRQn];
+    CORE_DMB();
+    IRQHT_Table[IRQn] = New;
+    CORE_DSB();
+    CORE_ISB();
+
+    *Old = 0;
+    if (Previous == 0)
+    {
+        return OK;
+    }
+
+    if (NVIC_GetActive(IRQn) == 0U)
+    {
+        *Old = Previous;
+    }
+    else
+    {
+        Previous->Next = IRQHT_Retired[IRQn];
+        IRQHT_Retired[IRQn] = Previous;
+    }
+
+    return OK;
+}
+
+/**
+ * @brief Hands back a retired binding of an IRQ whose grace period has ended.
+ *
+ * Every retired binding was unpublished before this read of IABR, so one inactive
+ * reading ends the grace period of all of them.
+ */
+IRQHT_Binding_t* IRQHT_Reclaim(IRQn_Type IRQn)
+{
+    IRQHT_Binding_t* Binding = 0;
+
+    if ((uint32_t)IRQn >= NVIC_IRQ_COUNT)
+    {
+        return 0;
+    }
+
+    Binding = IRQHT_Retired[IRQn];
+    if ((Binding == 0) || (NVIC_GetActive(IRQn) != 0U))
+    {
+        return 0;
+    }
+
+    IRQHT_Retired[IRQn] = Binding->Next;
+    Binding->Next = 0;
+
+    return Binding;
+}
+
+/**
+ * @brief Returns the binding currently published for an IRQ.
+ */
+IRQHT_Binding_t* IRQHT_Get(IRQn_Type IRQn)
+{
+    return ((uint32_t)IRQn < NVIC_IRQ_COUNT) ? IRQHT_Table[IRQn] : 0;
+}
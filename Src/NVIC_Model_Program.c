@@ -0,0 +1,161 @@
+/**
+ * @file NVIC_Model_Program.c
+ * @brief Program for the software model of the NVIC registers used by host builds.
+ *
+ * Bits are updated with atomic read-modify-write operations, the equivalent of the
+ * write-1-to-set/clear registers of the hardware, so that any thread may pend an IRQ.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/NVIC_Model_Interface.h"
+
+/**
+ * @brief Clears every enable, pending and active bit and every priority.
+ */
+void NVIC_Model_Reset(NVIC_Model_t* Model)
+{
+    uint32_t Index = 0U;
+
+    for (Index = 0U; Index < NVIC_IRQ_WORDS; Index++)
+    {
+        Model->Enabled[Index] = 0U;
+        Model->Pending[Index] = 0U;
+        Model->Active[Index] = 0U;
+    }
+    for (Index = 0U; Index < NVIC_IRQ_COUNT; Index++)
+    {
+        Model->Priority[Index] = 0U;
+    }
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief Sets or clears the enable bit of an IRQ.
+ */
+void NVIC_Model_SetEnabled(NVIC_Model_t* Model, IRQn_Type IRQn, uint8_t Enable)
+{
+    uint32_t Mask = 1UL << ((uint32_t)IRQn % 32U);
+
+    if (Enable != 0U)
+    {
+        (void)__atomic_fetch_or(&Model->Enabled[(uint32_t)IRQn / 32U], Mask, __ATOMIC_SEQ_CST);
+    }
+    else
+    {
+        (void)__atomic_fetch_and(&Model->Enabled[(uint32_t)IRQn / 32U], ~Mask, __ATOMIC_SEQ_CST);
+    }
+}
+
+/**
+ * @brief Sets or clears the pending bit of an IRQ.
+ */
+uint8_t NVIC_Model_SetPending(NVIC_Model_t* Model, IRQn_Type IRQn, uint8_t Pending)
+{
+    uint32_t Mask = 1UL << ((uint32_t)IRQn % 32U);
+    uint32_t Previous = 0U;
+
+    if (Pending != 0U)
+    {
+        Previous = __atomic_fetch_or(&Model->Pending[(uint32_t)IRQn / 32U], Mask, __ATOMIC_SEQ_CST);
+    }
+    else
+    {
+        Previous = __atomic_fetch_and(&Model->Pending[(uint32_t)IRQn / 32U], ~Mask, __ATOMIC_SEQ_CST);
+    }
+
+    return (uint8_t)(((Previous & Mask) != 0U) ? 1U : 0U);
+}
+
+/**
+ * @brief Sets the priority of an IRQ, values above 15 are clamped.
+ */
+void NVIC_Model_SetPriority(NVIC_Model_t* Model, IRQn_Type IRQn, uint32_t Priority)
+{
+    __atomic_store_n(&Model->Priority[IRQn], (uint8_t)((Priority > 15U) ? 15U : Priority), __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief Reads one bit of the Enabled, Pending or Active words.
+ */
+uint8_t NVIC_Model_GetBit(const volatile uint32_t* Words, IRQn_Type IRQn)
+{
+    uint32_t Word = __atomic_load_n(&Words[(uint32_t)IRQn / 32U], __ATOMIC_SEQ_CST);
+
+    return (uint8_t)((Word >> ((uint32_t)IRQn % 32U)) & 1U);
+}
+
+/**
+ * @brief Reports whether an IRQ is enabled, pending and not active.
+ */
+uint8_t NVIC_Model_IsDeliverable(const NVIC_Model_t* Model, IRQn_Type IRQn)
+{
+    return (uint8_t)(NVIC_Model_GetBit(Model->Enabled, IRQn) & NVIC_Model_GetBit(Model->Pending, IRQn) &
+                     (uint8_t)(NVIC_Model_GetBit(Model->Active, IRQn) ^ 1U));
+}
+
+/**
+ * @brief Finds the IRQ the hardware would take next among one priority level.
+ */
+int32_t NVIC_Model_NextAtLevel(const NVIC_Model_t* Model, uint32_t Level)
+{
+    uint32_t Word = 0U;
+    uint32_t Candidates = 0U;
+    uint32_t Bit = 0U;
+    uint32_t IRQn = 0U;
+
+    for (Word = 0U; Word < NVIC_IRQ_WORDS; Word++)
+    {
+        Candidates = __atomic_load_n(&Model->Enabled[Word], __ATOMIC_SEQ_CST) &
+                     __atomic_load_n(&Model->Pending[Word], __ATOMIC_SEQ_CST) &
+                     ~__atomic_load_n(&Model->Active[Word], __ATOMIC_SEQ_CST);
+        while (Candidates != 0U)
+        {
+            Bit = (uint32_t)__builtin_ctz(Candidates);
+            IRQn = (Word * 32U) + Bit;
+            if ((IRQn < NVIC_IRQ_COUNT) && (Model->Priority[IRQn] == Level))
+            {
+                return (int32_t)IRQn;
+            }
+            Candidates &= Candidates - 1U;
+        }
+    }
+
+    return NVIC_MODEL_NONE;
+}
+
+/**
+ * @brief Finds the IRQ the hardware would take next across every level.
+ */
+int32_t NVIC_Model_Next(const NVIC_Model_t* Model, uint32_t BelowLevel)
+{
+    uint32_t Level = 0U;
+    int32_t IRQn = NVIC_MODEL_NONE;
+
+    for (Level = 0U; (Level < BelowLevel) && (Level < NVIC_MODEL_LEVELS) && (IRQn == NVIC_MODEL_NONE); Level++)
+    {
+        IRQn = NVIC_Model_NextAtLevel(Model, Level);
+    }
+
+    return IRQn;
+}
+
+/**
+ * @brief Enters the handler of an IRQ: clears its pending bit and sets its active bit.
+ */
+void NVIC_Model_Activate(NVIC_Model_t* Model, IRQn_Type IRQn)
+{
+    uint32_t Mask = 1UL << ((uint32_t)IRQn % 32U);
+
+    (void)__atomic_fetch_or(&Model->Active[(uint32_t)IRQn / 32U], Mask, __ATOMIC_SEQ_CST);
+    (void)__atomic_fetch_and(&Model->Pending[(uint32_t)IRQn / 32U], ~Mask, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief Leaves the handler of an IRQ: clears its active bit.
+ */
+void NVIC_Model_Deactivate(NVIC_Model_t* Model, IRQn_Type IRQn)
+{
+    (void)__atomic_fetch_and(&Model->Active[(uint32_t)IRQn / 32U], ~(1UL << ((uint32_t)IRQn % 32U)), __ATOMIC_SEQ_CST);
+}
@@ -0,0 +1,538 @@
+/**
+ * @file NVIC_Posix_Program.c
+ * @brief Program for the POSIX (Linux) port of the NVIC driver.
+ *
+ * This file implements NVIC_Interface.h on top of NVIC_Model_t and real-time signals:
+ * level n of the NVIC is signal SIGRTMIN + n, sent to the CPU thread whenever an IRQ of
+ * that level becomes deliverable. The kernel's signal masks then provide the NVIC
+ * preemption rules for free: a level handler blocks its own and every less urgent level,
+ * and leaves the more urgent ones free to interrupt it.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <signal.h>
+#include <pthread.h>
+#include <errno.h>
+#include <time.h>
+#include <sched.h>
+
+#include "../Inc/NVIC_Interface.h"
+#include "../Inc/NVIC_Model_Interface.h"
+#include "../Inc/NVIC_Posix_Interface.h"
+#include "../Inc/NVIC_Posix_Private.h"
+#include "../../../LIB/ErrType.h"
+
+static NVIC_Model_t NVIC_Posix_Model;                              /**< Register state shared with the peripherals */
+static NVIC_Posix_Handler_t NVIC_Posix_Handlers[NVIC_IRQ_COUNT];   /**< Registered handlers */
+static pthread_t NVIC_Posix_Cpu;                                   /**< Thread playing the CPU */
+static volatile uint8_t NVIC_Posix_Ready = 0U;                     /**< Set once NVIC_Posix_Init() has run */
+static volatile uint32_t NVIC_Posix_Raised = 0U;                   /**< One bit per level with a signal in flight */
+static volatile uint8_t NVIC_Posix_Synchronous = 0U;               /**< Deliver only at sync points, no signals */
+static NVIC_Posix_Hook_t volatile NVIC_Posix_Hook = 0;             /**< Observer of pends and handler entries */
+
+/* State of the CPU thread only */
+static uint32_t NVIC_Posix_RunningLevel = NVIC_MODEL_LEVELS;       /**< Level of the running handler, 16 in thread mode */
+static uint32_t NVIC_Posix_BasePri = 0U;                           /**< Emulated BASEPRI level, 0 when off */
+static uint8_t NVIC_Posix_PriMask = 0U;                            /**< Emulated PRIMASK */
+static uint32_t NVIC_Posix_Taken = 0U;                             /**< Handlers run, for the idle loop */
+
+static void NVIC_Posix_Raise(IRQn_Type IRQn);
+static uint8_t NVIC_Posix_Notify(NVIC_Posix_Event_t Event, int32_t IRQn);
+static uint8_t NVIC_Posix_IsCpu(void);
+static void NVIC_Posix_Sync(void);
+static void NVIC_Posix_Run(IRQn_Type IRQn);
+static void NVIC_Posix_LevelHandler(int Signal);
+static void NVIC_Posix_LevelsFrom(uint32_t Level, sigset_t* Set);
+static uint32_t NVIC_Posix_Threshold(void);
+static void NVIC_Posix_ApplyMask(void);
+
+/**
+ * @brief Makes the calling thread the emulated CPU and installs the level signal handlers.
+ *
+ * @return uint8_t OK on success, NOK when the real-time signals are not available.
+ */
+uint8_t NVIC_Posix_Init(void)
+{
+    struct sigaction Action;
+    uint32_t Level = 0U;
+
+    if ((SIGRTMAX - SIGRTMIN + 1) < (int)NVIC_MODEL_LEVELS)
+    {
+        return NOK;
+    }
+
+    NVIC_Model_Reset(&NVIC_Posix_Model);
+    NVIC_Posix_Cpu = pthread_self();
+    NVIC_Posix_RunningLevel = NVIC_MODEL_LEVELS;
+    NVIC_Posix_BasePri = 0U;
+    NVIC_Posix_PriMask = 0U;
+    __atomic_store_n(&NVIC_Posix_Raised, 0U, __ATOMIC_SEQ_CST);
+
+    for (Level = 0U; Level < NVIC_MODEL_LEVELS; Level++)
+    {
+        Action.sa_handler = NVIC_Posix_LevelHandler;
+        Action.sa_flags = SA_RESTART;
+        NVIC_Posix_LevelsFrom(Level, &Action.sa_mask);   /**< Same and lower urgency cannot preempt */
+        if (sigaction(NVIC_POSIX_SIGNAL(Level), &Action, 0) != 0)
+        {
+            return NOK;
+        }
+    }
+
+    NVIC_Posix_ApplyMask();
+    __atomic_store_n(&NVIC_Posix_Ready, 1U, __ATOMIC_SEQ_CST);
+
+    return OK;
+}
+
+/**
+ * @brief Registers the handler run when an IRQ is taken.
+ */
+void NVIC_Posix_SetHandler(IRQn_Type IRQn, NVIC_Posix_Handler_t Handler)
+{
+    __atomic_store_n(&NVIC_Posix_Handlers[IRQn], Handler, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief Returns the register model shared by the port and the simulated peripherals.
+ */
+NVIC_Model_t* NVIC_Posix_GetModel(void)
+{
+    return &NVIC_Posix_Model;
+}
+
+/**
+ * @brief Installs the observer called on every pend, handler entry, handler exit and sync point.
+ */
+void NVIC_Posix_SetHook(NVIC_Posix_Hook_t Hook)
+{
+    __atomic_store_n(&NVIC_Posix_Hook, Hook, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief Selects signal-driven (asynchronous) or sync-point (synchronous) delivery.
+ *
+ * Leaving the synchronous mode raises the signal of every IRQ that became deliverable
+ * meanwhile.
+ */
+void NVIC_Posix_SetSynchronous(uint8_t Synchronous)
+{
+    uint32_t IRQn = 0U;
+
+    __atomic_store_n(&NVIC_Posix_Synchronous, (uint8_t)(Synchronous != 0U), __ATOMIC_SEQ_CST);
+    if (Synchronous == 0U)
+    {
+        for (IRQn = 0U; IRQn < NVIC_IRQ_COUNT; IRQn++)
+        {
+            NVIC_Posix_Raise((IRQn_Type)IRQn);
+        }
+    }
+}
+
+/**
+ * @brief Sync point: runs, on the CPU thread, every IRQ able to preempt the current context.
+ *
+ * Calls from other threads are ignored.
+ */
+void NVIC_Posix_DispatchPending(void)
+{
+    int32_t IRQn = NVIC_MODEL_NONE;
+
+    if ((NVIC_Posix_Ready == 0U) || (NVIC_Posix_IsCpu() == 0U))
+    {
+        return;
+    }
+
+    (void)NVIC_Posix_Notify(NVIC_POSIX_EVENT_SYNC, NVIC_MODEL_NONE);
+
+    while ((IRQn = NVIC_Model_Next(&NVIC_Posix_Model, NVIC_Posix_Threshold())) != NVIC_MODEL_NONE)
+    {
+        NVIC_Posix_Run((IRQn_Type)IRQn);
+    }
+}
+
+/**
+ * @brief Masks every interrupt on the CPU thread (equivalent of PRIMASK = 1).
+ */
+void NVIC_Posix_DisableInterrupts(void)
+{
+    NVIC_Posix_PriMask = 1U;
+    NVIC_Posix_ApplyMask();
+}
+
+/**
+ * @brief Unmasks the interrupts masked by NVIC_Posix_DisableInterrupts().
+ */
+void NVIC_Posix_EnableInterrupts(void)
+{
+    NVIC_Posix_PriMask = 0U;
+    NVIC_Posix_ApplyMask();
+    NVIC_Posix_Sync();
+}
+
+/**
+ * @brief Masks the levels numerically >= Level on the CPU thread (equivalent of BASEPRI).
+ *
+ * As on the core, a handler that changes BASEPRI must restore it before returning: the
+ * signal mask of the interrupted context is reinstated when the handler returns.
+ */
+void NVIC_Posix_SetBasePri(uint32_t Level)
+{
+    NVIC_Posix_BasePri = (Level >= NVIC_MODEL_LEVELS) ? 0U : Level;
+    NVIC_Posix_ApplyMask();
+    NVIC_Posix_Sync();
+}
+
+/**
+ * @brief Sleeps until an interrupt has been handled (equivalent of WFI).
+ *
+ * In synchronous mode every polling round is a sync point, so the number of rounds
+ * spent idle is part of the logical timeline.
+ */
+void NVIC_Posix_WaitForInterrupt(void)
+{
+    static const struct timespec Poll = { 0, NVIC_POSIX_IDLE_POLL_NS };
+    sigset_t Current;
+    uint32_t Taken = 0U;
+
+    if (NVIC_Posix_Synchronous == 0U)
+    {
+        (void)pthread_sigmask(SIG_SETMASK, 0, &Current);
+        (void)sigsuspend(&Current);   /**< Returns after a level handler has run */
+        return;
+    }
+
+    for (;;)
+    {
+        Taken = NVIC_Posix_Taken;
+        NVIC_Posix_DispatchPending();
+        if (NVIC_Posix_Taken != Taken)
+        {
+            return;
+        }
+        (void)nanosleep(&Poll, 0);
+    }
+}
+
+/**
+ * @brief Enables the specified IRQ interrupt.
+ */
+void NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+    NVIC_Model_SetEnabled(&NVIC_Posix_Model, IRQn, 1U);
+    NVIC_Posix_Raise(IRQn);
+    NVIC_Posix_Sync();
+}
+
+/**
+ * @brief Clears a stale pending state of the specified IRQ, then enables it.
+ */
+void NVIC_EnableIRQClean(IRQn_Type IRQn)
+{
+    (void)NVIC_Model_SetPending(&NVIC_Posix_Model, IRQn, 0U);
+    NVIC_Model_SetEnabled(&NVIC_Posix_Model, IRQn, 1U);
+    NVIC_Posix_Raise(IRQn);   /**< A pend raised by another thread after the clear */
+    NVIC_Posix_Sync();
+}
+
+/**
+ * @brief Clears the stale pending state of a set of IRQs, then enables them.
+ */
+void NVIC_EnableIRQMaskClean(const uint32_t Masks[NVIC_IRQ_WORDS])
+{
+    uint32_t IRQn = 0U;
+
+    for (IRQn = 0U; IRQn < NVIC_IRQ_COUNT; IRQn++)
+    {
+        if ((Masks[IRQn / 32U] & (1UL << (IRQn % 32U))) != 0U)
+        {
+            (void)NVIC_Model_SetPending(&NVIC_Posix_Model, (IRQn_Type)IRQn, 0U);
+        }
+    }
+    for (IRQn = 0U; IRQn < NVIC_IRQ_COUNT; IRQn++)
+    {
+        if ((Masks[IRQn / 32U] & (1UL << (IRQn % 32U))) != 0U)
+        {
+            NVIC_Model_SetEnabled(&NVIC_Posix_Model, (IRQn_Type)IRQn, 1U);
+            NVIC_Posix_Raise((IRQn_Type)IRQn);
+        }
+    }
+    NVIC_Posix_Sync();
+}
+
+/**
+ * @brief Disables the specified IRQ interrupt.
+ */
+void NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+    NVIC_Model_SetEnabled(&NVIC_Posix_Model, IRQn, 0U);
+    NVIC_Posix_Sync();
+}
+
+/**
+ * @brief Disables the specified IRQ interrupt and returns once its handler has left.
+ *
+ * From another thread the handler may be running on the CPU thread: the call yields until
+ * its active bit clears. On the CPU thread an active handler is preempted by the caller.
+ */
+uint8_t NVIC_DisableIRQSync(IRQn_Type IRQn)
+{
+    NVIC_Model_SetEnabled(&NVIC_Posix_Model, IRQn, 0U);
+
+    if (NVIC_Posix_IsCpu() != 0U)
+    {
+        NVIC_Posix_Sync();
+        return (NVIC_Model_GetBit(NVIC_Posix_Model.Active, IRQn) != 0U) ? NOK : OK;
+    }
+
+    while (NVIC_Model_GetBit(NVIC_Posix_Model.Active, IRQn) != 0U)
+    {
+        (void)sched_yield();
+    }
+
+    return OK;
+}
+
+/**
+ * @brief Sets the pending bit for the specified IRQ interrupt; callable from any thread.
+ *
+ * The hook sees the pend first and may take it over (see NVIC_Posix_Hook_t).
+ */
+void NVIC_SetPendingIRQ(IRQn_Type IRQn)
+{
+    if (NVIC_Posix_Notify(NVIC_POSIX_EVENT_PEND, (int32_t)IRQn) == 0U)
+    {
+        return;
+    }
+
+    (void)NVIC_Model_SetPending(&NVIC_Posix_Model, IRQn, 1U);
+    NVIC_Posix_Raise(IRQn);
+    NVIC_Posix_Sync();
+}
+
+/**
+ * @brief Clears the pending bit for the specified IRQ interrupt.
+ */
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn)
+{
+    (void)NVIC_Model_SetPending(&NVIC_Posix_Model, IRQn, 0U);
+    NVIC_Posix_Sync();
+}
+
+/**
+ * @brief Retrieves the pending state of the specified IRQ interrupt.
+ */
+uint8_t NVIC_GetPendingIRQ(IRQn_Type IRQn)
+{
+    NVIC_Posix_Sync();   /**< Polling loops must advance the logical time */
+
+    return NVIC_Model_GetBit(NVIC_Posix_Model.Pending, IRQn);
+}
+
+/**
+ * @brief Sets the priority level for the specified IRQ interrupt.
+ */
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority)
+{
+    NVIC_Model_SetPriority(&NVIC_Posix_Model, IRQn, priority);
+    NVIC_Posix_Raise(IRQn);   /**< A pending IRQ moves to the signal of its new level */
+    NVIC_Posix_Sync();
+}
+
+/**
+ * @brief Retrieves the priority level of the specified IRQ interrupt.
+ */
+uint32_t NVIC_GetPriority(IRQn_Type IRQn)
+{
+    return (uint32_t)NVIC_Posix_Model.Priority[IRQn];
+}
+
+/**
+ * @brief Reads the active flag status of the specified IRQ interrupt.
+ */
+uint8_t NVIC_GetActive(IRQn_Type IRQn)
+{
+    NVIC_Posix_Sync();
+
+    return NVIC_Model_GetBit(NVIC_Posix_Model.Active, IRQn);
+}
+
+/**
+ * @brief Reads the highest-priority pending IRQ; the port has no system exceptions.
+ *
+ * As VECTPENDING, it leaves out the IRQs masked by the emulated BASEPRI but not those
+ * held back by the emulated PRIMASK.
+ */
+int32_t NVIC_GetHighestPending(void)
+{
+    int32_t IRQn = 0;
+
+    NVIC_Posix_Sync();
+    IRQn = NVIC_Model_Next(&NVIC_Posix_Model, (NVIC_Posix_BasePri != 0U) ? NVIC_Posix_BasePri : NVIC_MODEL_LEVELS);
+
+    return (IRQn == NVIC_MODEL_NONE) ? NVIC_NO_PENDING : IRQn;
+}
+
+/**
+ * @brief Sends the signal of an IRQ's level to the CPU thread if the IRQ is deliverable.
+ *
+ * One signal per level is kept in flight: the level handler drains every IRQ of its
+ * level, so further signals would only fill the real-time signal queue.
+ */
+static void NVIC_Posix_Raise(IRQn_Type IRQn)
+{
+    uint32_t Level = 0U;
+    uint32_t Bit = 0U;
+
+    if ((NVIC_Posix_Ready == 0U) || (NVIC_Posix_Synchronous != 0U) ||
+        (NVIC_Model_IsDeliverable(&NVIC_Posix_Model, IRQn) == 0U))
+    {
+        return;
+    }
+
+    Level = NVIC_Posix_Model.Priority[IRQn];
+    Bit = 1UL << Level;
+    if ((__atomic_fetch_or(&NVIC_Posix_Raised, Bit, __ATOMIC_SEQ_CST) & Bit) == 0U)
+    {
+        (void)pthread_kill(NVIC_Posix_Cpu, NVIC_POSIX_SIGNAL(Level));
+    }
+}
+
+/**
+ * @brief Passes an event to the hook.
+ *
+ * @return uint8_t The hook's verdict, 1 when no hook is installed.
+ */
+static uint8_t NVIC_Posix_Notify(NVIC_Posix_Event_t Event, int32_t IRQn)
+{
+    NVIC_Posix_Hook_t Hook = __atomic_load_n(&NVIC_Posix_Hook, __ATOMIC_SEQ_CST);
+
+    if (Hook == 0)
+    {
+        return 1U;
+    }
+
+    return Hook(Event, IRQn, NVIC_Posix_IsCpu());
+}
+
+/**
+ * @brief Reports whether the caller is the CPU thread.
+ */
+static uint8_t NVIC_Posix_IsCpu(void)
+{
+    return (uint8_t)(pthread_equal(pthread_self(), NVIC_Posix_Cpu) != 0);
+}
+
+/**
+ * @brief Ends an NVIC call: a sync point when the synchronous mode is on.
+ */
+static void NVIC_Posix_Sync(void)
+{
+    if (NVIC_Posix_Synchronous != 0U)
+    {
+        NVIC_Posix_DispatchPending();
+    }
+}
+
+/**
+ * @brief Takes an IRQ: runs its handler at its priority level with the active bit set.
+ */
+static void NVIC_Posix_Run(IRQn_Type IRQn)
+{
+    uint32_t PreviousLevel = NVIC_Posix_RunningLevel;
+    NVIC_Posix_Handler_t Handler = __atomic_load_n(&NVIC_Posix_Handlers[IRQn], __ATOMIC_SEQ_CST);
+
+    NVIC_Model_Activate(&NVIC_Posix_Model, IRQn);
+    NVIC_Posix_RunningLevel = NVIC_Posix_Model.Priority[IRQn];
+    NVIC_Posix_Taken++;
+    (void)NVIC_Posix_Notify(NVIC_POSIX_EVENT_ENTER, (int32_t)IRQn);
+
+    if (Handler != 0)
+    {
+        Handler();
+    }
+
+    (void)NVIC_Posix_Notify(NVIC_POSIX_EVENT_EXIT, (int32_t)IRQn);
+    NVIC_Posix_RunningLevel = PreviousLevel;
+    NVIC_Model_Deactivate(&NVIC_Posix_Model, IRQn);
+}
+
+/**
+ * @brief Signal handler of one priority level: runs every deliverable IRQ of the level.
+ *
+ * The in-flight bit is cleared before the scan, so an IRQ pended after the scan has
+ * passed it raises a new signal, delivered as soon as this handler returns.
+ */
+static void NVIC_Posix_LevelHandler(int Signal)
+{
+    uint32_t Level = (uint32_t)(Signal - SIGRTMIN);
+    int SavedErrno = errno;
+    int32_t IRQn = NVIC_MODEL_NONE;
+
+    (void)__atomic_fetch_and(&NVIC_Posix_Raised, ~(1UL << Level), __ATOMIC_SEQ_CST);
+
+    /* A signal raised just before switching to the synchronous mode is left to the sync points */
+    while ((NVIC_Posix_Synchronous == 0U) &&
+           ((IRQn = NVIC_Model_NextAtLevel(&NVIC_Posix_Model, Level)) != NVIC_MODEL_NONE))
+    {
+        NVIC_Posix_Run((IRQn_Type)IRQn);
+    }
+
+    errno = SavedErrno;
+}
+
+/**
+ * @brief Builds the set of level signals numerically >= Level.
+ */
+static void NVIC_Posix_LevelsFrom(uint32_t Level, sigset_t* Set)
+{
+    (void)sigemptyset(Set);
+    for (; Level < NVIC_MODEL_LEVELS; Level++)
+    {
+        (void)sigaddset(Set, NVIC_POSIX_SIGNAL(Level));
+    }
+}
+
+/**
+ * @brief Returns the first level masked on the CPU thread by the running level, BASEPRI and PRIMASK.
+ */
+static uint32_t NVIC_Posix_Threshold(void)
+{
+    uint32_t Threshold = NVIC_Posix_RunningLevel;
+
+    if ((NVIC_Posix_BasePri != 0U) && (NVIC_Posix_BasePri < Threshold))
+    {
+        Threshold = NVIC_Posix_BasePri;
+    }
+    if (NVIC_Posix_PriMask != 0U)
+    {
+        Threshold = 0U;
+    }
+
+    return Threshold;
+}
+
+/**
+ * @brief Programs the CPU thread's signal mask from the running level, BASEPRI and PRIMASK.
+ */
+static void NVIC_Posix_ApplyMask(void)
+{
+    sigset_t Mask;
+    uint32_t Threshold = NVIC_Posix_Threshold();
+    uint32_t Level = 0U;
+
+    (void)pthread_sigmask(SIG_SETMASK, 0, &Mask);
+    for (Level = 0U; Level < NVIC_MODEL_LEVELS; Level++)
+    {
+        (void)sigdelset(&Mask, NVIC_POSIX_SIGNAL(Level));
+    }
+    for (Level = Threshold; Level < NVIC_MODEL_LEVELS; Level++)
+    {
+        (void)sigaddset(&Mask, NVIC_POSIX_SIGNAL(Level));
+    }
+    (void)pthread_sigmask(SIG_SETMASK, &Mask, 0);
+}
@@ -13,6 +13,7 @@
 #include "../Inc/NVIC_Interface.h"
 #include "../Inc/NVIC_Private.h"
 #include "../../../LIB/STM32F446xx.h"
+#include "../../../LIB/CORE_Intrinsics.h"
 #include "../../../LIB/ErrType.h"
 
 
@@ -27,6 +28,75 @@ void NVIC_EnableIRQ(IRQn_Type IRQn)
     uint8_t BitNum = (uint8_t)(IRQn % 32U);  /**< Bit position within the register */
 
     NVIC->ISER[RegNum] = (uint32_t)(1UL << BitNum); /**< Enable the IRQ by setting the corresponding bit */
+    NVIC_BOOTPROF_HOOK(BOOTPROF_EVENT_ENABLE, IRQn, 0U);
+}
+
+/**
+ * @brief Clears a stale pending state of the specified IRQ, then enables it.
+ *
+ * The DSB between the two writes makes the clear reach the NVIC before the enable can
+ * let a stale pend through. The last DSB/ISB pair makes the enable effective before the
+ * caller goes on.
+ *
+ * @param[in] IRQn IRQ number to enable of type IRQn_Type.
+ */
+void NVIC_EnableIRQClean(IRQn_Type IRQn)
+{
+    uint8_t RegNum = (uint8_t)(IRQn / 32U);  /**< Register index in the ICPR and ISER arrays */
+    uint8_t BitNum = (uint8_t)(IRQn % 32U);  /**< Bit position within the register */
+
+    NVIC->ICPR[RegNum] = (uint32_t)(1UL << BitNum);
+    CORE_DSB();
+    NVIC->ISER[RegNum] = (uint32_t)(1UL << BitNum);
+    CORE_DSB();
+    CORE_ISB();
+    NVIC_BOOTPROF_HOOK(BOOTPROF_EVENT_ENABLE, IRQn, 0U);
+}
+
+/**
+ * @brief Clears the stale pending state of a set of IRQs, then enables them.
+ *
+ * All the clears are completed before the first enable, so no IRQ of the set can be
+ * taken on a stale pend while the others are being enabled.
+ *
+ * @param[in] Masks NVIC_IRQ_WORDS words of IRQ bits.
+ */
+void NVIC_EnableIRQMaskClean(const uint32_t Masks[NVIC_IRQ_WORDS])
+{
+    uint8_t RegNum = 0U;
+
+    for (RegNum = 0U; RegNum < NVIC_IRQ_WORDS; RegNum++)
+    {
+        if (Masks[RegNum] != 0U)
+        {
+            NVIC->ICPR[RegNum] = Masks[RegNum];
+        }
+    }
+    CORE_DSB();
+
+    for (RegNum = 0U; RegNum < NVIC_IRQ_WORDS; RegNum++)
+    {
+        if (Masks[RegNum] != 0U)
+        {
+            NVIC->ISER[RegNum] = Masks[RegNum];
+        }
+    }
+    CORE_DSB();
+    CORE_ISB();
+
+#ifdef NVIC_BOOTPROF
+    {
+        uint32_t IRQn = 0U;
+
+        for (IRQn = 0U; IRQn < NVIC_IRQ_COUNT; IRQn++)
+        {
+            if ((Masks[IRQn / 32U] & (1UL << (IRQn % 32U))) != 0U)
+            {
+                NVIC_BOOTPROF_HOOK(BOOTPROF_EVENT_ENABLE, (IRQn_Type)IRQn, 0U);
+            }
+        }
+    }
+#endif
 }
 
 /**
@@ -45,6 +115,30 @@ void NVIC_DisableIRQ(IRQn_Type IRQn)
     NVIC->ICER[RegNum] = (uint32_t)(1UL << BitNum); /**< Disable the IRQ by clearing the corresponding bit */
 }
 
+/**
+ * @brief Disables the specified IRQ interrupt and returns once its handler cannot run.
+ *
+ * The DSB completes the ICER write on the PPB, the ISB discards instructions fetched
+ * while the IRQ could still be taken. An entry racing the write happens before the DSB
+ * retires and returns before this code goes on, so after the barriers the handler has
+ * either finished or sits preempted beneath the caller: one IABR read tells them apart,
+ * a spin would never see the bit clear on a single core.
+ *
+ * @param[in] IRQn IRQ number to disable of type IRQn_Type.
+ * @return uint8_t OK when the handler is quiescent, NOK when the caller is nested above it.
+ */
+uint8_t NVIC_DisableIRQSync(IRQn_Type IRQn)
+{
+    uint8_t RegNum = (uint8_t)(IRQn / 32U);  /**< Register index in the ICER and IABR arrays */
+    uint8_t BitNum = (uint8_t)(IRQn % 32U);  /**< Bit position within the register */
+
+    NVIC->ICER[RegNum] = (uint32_t)(1UL << BitNum);
+    CORE_DSB();
+    CORE_ISB();
+
+    return ((NVIC->IABR[RegNum] & (1UL << BitNum)) != 0U) ? NOK : OK;
+}
+
 /**
  * @brief Sets the pending bit for the specified IRQ interrupt.
  * 
@@ -82,7 +176,7 @@ void NVIC_ClearPendingIRQ(IRQn_Type IRQn)
  * Returns the pending status of an interrupt, indicating whether it is currently marked as pending.
  * 
  * @param[in] IRQn IRQ number to check of type IRQn_Type.
- * @return uint32_t Returns 1 if the interrupt is pending; 0 otherwise.
+ * @return uint8_t Returns 1 if the interrupt is pending; 0 otherwise.
  */
 uint8_t NVIC_GetPendingIRQ(IRQn_Type IRQn)
 {
@@ -91,7 +185,8 @@ uint8_t NVIC_GetPendingIRQ(IRQn_Type IRQn)
 
     uint8_t PendingStatus = 0U;
 
-   PendingStatus=(NVIC->ISPR[RegNum] & (1UL << BitNum)) ;
+    /* Reduce to 0/1 before narrowing: bits 8-31 would be lost in a uint8_t */
+    PendingStatus = (uint8_t)(((NVIC->ISPR[RegNum] & (1UL << BitNum)) != 0U) ? 1U : 0U);
 
     return PendingStatus;
 }
@@ -123,6 +218,7 @@ void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority)
     /* Assign the 4-bit priority level to the specific IRQ */
     NVIC->IPR[RegIndex] &= ~(0xF0U << PriorityPos);       /**< Clear the priority field */
     NVIC->IPR[RegIndex] |= ((priority & 0xFU) << (PriorityPos + 4U)); /**< Set the priority */
+    NVIC_BOOTPROF_HOOK(BOOTPROF_EVENT_PRIORITY, IRQn, priority);
 
     }
 
@@ -175,3 +271,18 @@ uint8_t NVIC_GetActive(IRQn_Type IRQn)
 
     return isActive;
 }
+
+/**
+ * @brief Reads the highest-priority pending exception.
+ *
+ * VECTPENDING holds the exception number, 0 when nothing is pending; subtracting 16
+ * gives the IRQ number.
+ *
+ * @return int32_t IRQ number of the exception, NVIC_NO_PENDING when none is pending.
+ */
+int32_t NVIC_GetHighestPending(void)
+{
+    uint32_t Exception = (SCB->ICSR >> NVIC_ICSR_VECTPENDING_POS) & NVIC_ICSR_VECTPENDING_MASK;
+
+    return (int32_t)Exception - NVIC_EXCEPTION_OFFSET;
+}
@@ -0,0 +1,365 @@
+/**
+ * @file NVIC_Replay_Program.c
+ * @brief Program for the deterministic record/replay of interrupts on the POSIX port.
+ *
+ * This file implements the port hook that logs or reproduces the interrupt timeline. The
+ * log is only touched on the CPU thread; peripheral threads reach the recorder through a
+ * lock-free queue drained at each sync point.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/NVIC_Replay_Interface.h"
+#include "../Inc/NVIC_Replay_Private.h"
+#include "../Inc/NVIC_Posix_Interface.h"
+#include "../Inc/NVIC_Model_Interface.h"
+#include "../../../LIB/ErrType.h"
+
+static volatile NVIC_Replay_Mode_t NVIC_Replay_Mode = NVIC_REPLAY_OFF;
+static FILE* NVIC_Replay_Log = 0;
+static NVIC_Replay_Status_t NVIC_Replay_State;
+static uint32_t NVIC_Replay_BreakTime = 0U;
+
+static NVIC_Replay_Record_t NVIC_Replay_Next;        /**< Next log record while replaying */
+static uint8_t NVIC_Replay_HaveNext = 0U;
+
+static NVIC_Replay_Slot_t NVIC_Replay_Queue[NVIC_REPLAY_QUEUE_SIZE];
+static volatile uint32_t NVIC_Replay_Head = 0U;      /**< Next slot claimed by a peripheral thread */
+static volatile uint32_t NVIC_Replay_Tail = 0U;      /**< Next slot drained by the CPU thread */
+
+static uint8_t NVIC_Replay_Hook(NVIC_Posix_Event_t Event, int32_t IRQn, uint8_t Local);
+static void NVIC_Replay_Enqueue(int32_t IRQn);
+static void NVIC_Replay_Drain(void);
+static void NVIC_Replay_Write(NVIC_Posix_Event_t Event, int32_t IRQn, uint8_t Local);
+static void NVIC_Replay_Inject(void);
+static void NVIC_Replay_Match(NVIC_Posix_Event_t Event, int32_t IRQn);
+static void NVIC_Replay_Advance(void);
+static void NVIC_Replay_Finish(uint8_t Diverged);
+static void NVIC_Replay_Begin(FILE* Log, NVIC_Replay_Mode_t Mode);
+
+/**
+ * @brief Starts logging the run to a binary file.
+ */
+uint8_t NVIC_Replay_StartRecording(FILE* Log)
+{
+    uint32_t Magic = NVIC_REPLAY_MAGIC;
+
+    if (Log == 0)
+    {
+        return NULL_PTR_ERR;
+    }
+    if ((NVIC_Replay_Mode != NVIC_REPLAY_OFF) || (fwrite(&Magic, sizeof(Magic), 1U, Log) != 1U))
+    {
+        return NOK;
+    }
+
+    NVIC_Replay_Begin(Log, NVIC_REPLAY_RECORDING);
+
+    return OK;
+}
+
+/**
+ * @brief Starts reproducing a log written by NVIC_Replay_StartRecording().
+ */
+uint8_t NVIC_Replay_StartReplay(FILE* Log)
+{
+    uint32_t Magic = 0U;
+
+    if (Log == 0)
+    {
+        return NULL_PTR_ERR;
+    }
+    if ((NVIC_Replay_Mode != NVIC_REPLAY_OFF) || (fread(&Magic, sizeof(Magic), 1U, Log) != 1U) ||
+        (Magic != NVIC_REPLAY_MAGIC))
+    {
+        return NOK;
+    }
+
+    NVIC_Replay_Log = Log;
+    NVIC_Replay_Advance();
+    NVIC_Replay_Begin(Log, NVIC_REPLAY_REPLAYING);
+
+    return OK;
+}
+
+/**
+ * @brief Stops recording or replaying and returns the port to signal delivery.
+ *
+ * Peripheral pends still queued are logged at the current logical time and applied.
+ */
+void NVIC_Replay_Stop(void)
+{
+    if (NVIC_Replay_Mode == NVIC_REPLAY_OFF)
+    {
+        return;
+    }
+
+    NVIC_Posix_SetHook(0);
+    if (NVIC_Replay_Mode == NVIC_REPLAY_RECORDING)
+    {
+        NVIC_Replay_Drain();
+        (void)fflush(NVIC_Replay_Log);
+    }
+
+    __atomic_store_n(&NVIC_Replay_Mode, NVIC_REPLAY_OFF, __ATOMIC_SEQ_CST);
+    NVIC_Replay_State.Mode = NVIC_REPLAY_OFF;
+    NVIC_Replay_Log = 0;
+    NVIC_Posix_SetSynchronous(0U);
+}
+
+/**
+ * @brief Asks for NVIC_Replay_Breakpoint() to be called when the logical time reaches Time.
+ */
+void NVIC_Replay_BreakAt(uint32_t Time)
+{
+    NVIC_Replay_BreakTime = Time;
+}
+
+/**
+ * @brief Retrieves the progress of the recording or replay.
+ */
+uint8_t NVIC_Replay_GetStatus(NVIC_Replay_Status_t* Status)
+{
+    if (Status == 0)
+    {
+        return NULL_PTR_ERR;
+    }
+
+    *Status = NVIC_Replay_State;
+    Status->Mode = NVIC_Replay_Mode;
+
+    return OK;
+}
+
+/**
+ * @brief Called at the requested logical time and at the first divergence.
+ */
+__attribute__((noinline)) void NVIC_Replay_Breakpoint(void)
+{
+    __asm volatile ("" : : : "memory");   /**< Keeps the call when optimising */
+}
+
+/**
+ * @brief Port hook: routes each event to the recorder or the replayer.
+ */
+static uint8_t NVIC_Replay_Hook(NVIC_Posix_Event_t Event, int32_t IRQn, uint8_t Local)
+{
+    NVIC_Replay_Mode_t Mode = __atomic_load_n(&NVIC_Replay_Mode, __ATOMIC_SEQ_CST);
+
+    if (Local == 0U)
+    {
+        if ((Event == NVIC_POSIX_EVENT_PEND) && (Mode == NVIC_REPLAY_RECORDING))
+        {
+            NVIC_Replay_Enqueue(IRQn);   /**< Applied at the next sync point */
+            return 0U;
+        }
+        return (uint8_t)((Event != NVIC_POSIX_EVENT_PEND) || (Mode != NVIC_REPLAY_REPLAYING));
+    }
+
+    if (Event == NVIC_POSIX_EVENT_SYNC)
+    {
+        if ((Mode == NVIC_REPLAY_RECORDING) || (Mode == NVIC_REPLAY_REPLAYING))
+        {
+            NVIC_Replay_State.Time++;
+            if (NVIC_Replay_State.Time == NVIC_Replay_BreakTime)
+            {
+                NVIC_Replay_Breakpoint();
+            }
+        }
+        if (Mode == NVIC_REPLAY_RECORDING)
+        {
+            NVIC_Replay_Drain();
+        }
+        else if (Mode == NVIC_REPLAY_REPLAYING)
+        {
+            NVIC_Replay_Inject();
+        }
+        else
+        {
+            /* Nothing to do once finished */
+        }
+    }
+    else if (Mode == NVIC_REPLAY_RECORDING)
+    {
+        NVIC_Replay_Write(Event, IRQn, 1U);
+    }
+    else if (Mode == NVIC_REPLAY_REPLAYING)
+    {
+        NVIC_Replay_Match(Event, IRQn);
+    }
+    else
+    {
+        /* Finished: the run goes on unobserved */
+    }
+
+    return 1U;
+}
+
+/**
+ * @brief Queues a peripheral pend; callable from any thread.
+ *
+ * A full queue drops the pend and counts it: the log and the run stay consistent, the
+ * interrupt is simply lost in both.
+ */
+static void NVIC_Replay_Enqueue(int32_t IRQn)
+{
+    uint32_t Head = __atomic_load_n(&NVIC_Replay_Head, __ATOMIC_SEQ_CST);
+
+    do
+    {
+        if ((Head - __atomic_load_n(&NVIC_Replay_Tail, __ATOMIC_SEQ_CST)) >= NVIC_REPLAY_QUEUE_SIZE)
+        {
+            (void)__atomic_fetch_add(&NVIC_Replay_State.Dropped, 1U, __ATOMIC_SEQ_CST);
+            return;
+        }
+    } while (!__atomic_compare_exchange_n(&NVIC_Replay_Head, &Head, Head + 1U, 0,
+                                          __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+    NVIC_Replay_Queue[Head & (NVIC_REPLAY_QUEUE_SIZE - 1U)].IRQn = (uint8_t)IRQn;
+    __atomic_store_n(&NVIC_Replay_Queue[Head & (NVIC_REPLAY_QUEUE_SIZE - 1U)].Full, 1U, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Logs and applies the queued peripheral pends at the current logical time.
+ *
+ * Stops at a slot claimed but not yet filled; it is picked up at the next sync point.
+ */
+static void NVIC_Replay_Drain(void)
+{
+    NVIC_Replay_Slot_t* Slot = 0;
+    uint32_t Tail = NVIC_Replay_Tail;
+
+    for (;;)
+    {
+        Slot = &NVIC_Replay_Queue[Tail & (NVIC_REPLAY_QUEUE_SIZE - 1U)];
+        if (__atomic_load_n(&Slot->Full, __ATOMIC_ACQUIRE) == 0U)
+        {
+            break;
+        }
+
+        NVIC_Replay_Write(NVIC_POSIX_EVENT_PEND, (int32_t)Slot->IRQn, 0U);
+        (void)NVIC_Model_SetPending(NVIC_Posix_GetModel(), (IRQn_Type)Slot->IRQn, 1U);
+
+        __atomic_store_n(&Slot->Full, 0U, __ATOMIC_RELAXED);
+        Tail++;
+        __atomic_store_n(&NVIC_Replay_Tail, Tail, __ATOMIC_RELEASE);
+    }
+}
+
+/**
+ * @brief Appends one record to the log.
+ */
+static void NVIC_Replay_Write(NVIC_Posix_Event_t Event, int32_t IRQn, uint8_t Local)
+{
+    NVIC_Replay_Record_t Record;
+
+    Record.Time = NVIC_Replay_State.Time;
+    Record.Event = (uint8_t)Event;
+    Record.IRQn = (uint8_t)IRQn;
+    Record.Local = Local;
+    Record.Reserved = 0U;
+
+    if (fwrite(&Record, sizeof(Record), 1U, NVIC_Replay_Log) == 1U)
+    {
+        NVIC_Replay_State.Records++;
+    }
+}
+
+/**
+ * @brief Applies the peripheral pends logged at the current logical time.
+ */
+static void NVIC_Replay_Inject(void)
+{
+    while ((NVIC_Replay_HaveNext != 0U) && (NVIC_Replay_Next.Event == (uint8_t)NVIC_POSIX_EVENT_PEND) &&
+           (NVIC_Replay_Next.Local == 0U) && (NVIC_Replay_Next.Time == NVIC_Replay_State.Time))
+    {
+        (void)NVIC_Model_SetPending(NVIC_Posix_GetModel(), (IRQn_Type)NVIC_Replay_Next.IRQn, 1U);
+        NVIC_Replay_State.Records++;
+        NVIC_Replay_Advance();
+    }
+
+    if (NVIC_Replay_HaveNext == 0U)
+    {
+        NVIC_Replay_Finish(0U);
+    }
+    else if (NVIC_Replay_Next.Time < NVIC_Replay_State.Time)
+    {
+        NVIC_Replay_Finish(1U);   /**< A logged event did not happen in time */
+    }
+    else
+    {
+        /* On track */
+    }
+}
+
+/**
+ * @brief Checks a firmware pend or a handler entry/exit against the log.
+ */
+static void NVIC_Replay_Match(NVIC_Posix_Event_t Event, int32_t IRQn)
+{
+    if (NVIC_Replay_HaveNext == 0U)
+    {
+        NVIC_Replay_Finish(0U);
+    }
+    else if ((NVIC_Replay_Next.Time == NVIC_Replay_State.Time) && (NVIC_Replay_Next.Event == (uint8_t)Event) &&
+             (NVIC_Replay_Next.IRQn == (uint8_t)IRQn) && (NVIC_Replay_Next.Local == 1U))
+    {
+        NVIC_Replay_State.Records++;
+        NVIC_Replay_Advance();
+    }
+    else
+    {
+        NVIC_Replay_Finish(1U);
+    }
+}
+
+/**
+ * @brief Reads the next record of the log.
+ */
+static void NVIC_Replay_Advance(void)
+{
+    NVIC_Replay_HaveNext = (uint8_t)(fread(&NVIC_Replay_Next, sizeof(NVIC_Replay_Next), 1U, NVIC_Replay_Log) == 1U);
+}
+
+/**
+ * @brief Ends the replay, at the end of the log or on a divergence; peripherals are live again.
+ */
+static void NVIC_Replay_Finish(uint8_t Diverged)
+{
+    __atomic_store_n(&NVIC_Replay_Mode, NVIC_REPLAY_FINISHED, __ATOMIC_SEQ_CST);
+
+    if (Diverged != 0U)
+    {
+        NVIC_Replay_State.Diverged = 1U;
+        NVIC_Replay_State.DivergedAt = NVIC_Replay_State.Time;
+        NVIC_Replay_Breakpoint();
+    }
+}
+
+/**
+ * @brief Resets the progress and the queue, then hooks into the port in its synchronous mode.
+ */
+static void NVIC_Replay_Begin(FILE* Log, NVIC_Replay_Mode_t Mode)
+{
+    uint32_t Index = 0U;
+
+    NVIC_Replay_Log = Log;
+    NVIC_Replay_State.Time = 0U;
+    NVIC_Replay_State.Records = 0U;
+    NVIC_Replay_State.Dropped = 0U;
+    NVIC_Replay_State.Diverged = 0U;
+    NVIC_Replay_State.DivergedAt = 0U;
+    NVIC_Replay_State.Mode = Mode;
+
+    for (Index = 0U; Index < NVIC_REPLAY_QUEUE_SIZE; Index++)
+    {
+        NVIC_Replay_Queue[Index].Full = 0U;
+    }
+    NVIC_Replay_Head = 0U;
+    NVIC_Replay_Tail = 0U;
+
+    __atomic_store_n(&NVIC_Replay_Mode, Mode, __ATOMIC_SEQ_CST);
+    NVIC_Posix_SetSynchronous(1U);
+    NVIC_Posix_SetHook(NVIC_Replay_Hook);
+}
@@ -0,0 +1,258 @@
+/**
+ * @file PERF_Program.c
+ * @brief Program for the per-ISR DWT performance counters.
+ *
+ * This file keeps a stack of the selected handlers being run. Each sample charges the
+ * counter differences since the previous sample to the handler on top of the stack, so
+ * a preempted handler is not charged for the selected handler that preempted it. The
+ * bookkeeping runs with interrupts masked: a preemption in the middle of it would charge
+ * the same difference twice.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/PERF_Interface.h"
+#include "../Inc/PERF_Private.h"
+#include "../Inc/NVIC_Interface.h"
+#include "../../../LIB/STM32F446xx.h"
+#include "../../../LIB/CORE_Intrinsics.h"
+#include "../../../LIB/ErrType.h"
+
+static PERF_IsrStats_t PERF_Stats[NVIC_IRQ_COUNT];
+static PERF_Overhead_t PERF_Overhead;
+static uint32_t PERF_Selected[NVIC_IRQ_WORDS];      /**< One bit per profiled IRQ */
+static PERF_Snapshot_t PERF_Last;                   /**< Counters at the previous sample */
+static uint8_t PERF_Stack[PERF_MAX_DEPTH];          /**< Selected handlers being run, innermost last */
+static uint8_t PERF_Depth = 0U;
+
+static uint8_t PERF_IsSelected(IRQn_Type IRQn);
+static void PERF_Sample(void);
+
+/**
+ * @brief Enables the DWT counters and clears every statistic and selection.
+ */
+void PERF_Init(void)
+{
+    uint32_t Index = 0U;
+
+    COREDEBUG->DEMCR |= (1UL << COREDEBUG_DEMCR_TRCENA);
+    DWT->CTRL |= (1UL << DWT_CTRL_CYCCNTENA) | (1UL << DWT_CTRL_CPIEVTENA) | (1UL << DWT_CTRL_EXCEVTENA) |
+                 (1UL << DWT_CTRL_SLEEPEVTENA) | (1UL << DWT_CTRL_LSUEVTENA) | (1UL << DWT_CTRL_FOLDEVTENA);
+
+    for (Index = 0U; Index < NVIC_IRQ_WORDS; Index++)
+    {
+        PERF_Selected[Index] = 0U;
+    }
+    PERF_Depth = 0U;
+    PERF_Reset();
+}
+
+/**
+ * @brief Selects or deselects an IRQ for profiling.
+ *
+ * Change the selection while the IRQ is not running: a handler deselected between its
+ * entry and exit hooks stays on the stack.
+ */
+void PERF_Select(IRQn_Type IRQn, uint8_t Enable)
+{
+    uint32_t State = CORE_EnterCritical();
+
+    if (Enable != 0U)
+    {
+        PERF_Selected[(uint32_t)IRQn / 32U] |= (1UL << ((uint32_t)IRQn % 32U));
+    }
+    else
+    {
+        PERF_Selected[(uint32_t)IRQn / 32U] &= ~(1UL << ((uint32_t)IRQn % 32U));
+    }
+
+    CORE_ExitCritical(State);
+}
+
+/**
+ * @brief Samples the counters at handler entry.
+ *
+ * The difference charged to the preempted handler ends here; the EXCCNT difference holds
+ * the entry overhead of this handler.
+ */
+void PERF_IsrEnter(IRQn_Type IRQn)
+{
+    uint32_t State = 0U;
+
+    if (PERF_IsSelected(IRQn) == 0U)
+    {
+        return;
+    }
+
+    State = CORE_EnterCritical();
+
+    PERF_Sample();
+    if (PERF_Depth < PERF_MAX_DEPTH)
+    {
+        PERF_Stack[PERF_Depth] = (uint8_t)IRQn;
+        PERF_Depth++;
+    }
+    PERF_Overhead.Entries++;
+
+    CORE_ExitCritical(State);
+}
+
+/**
+ * @brief Samples the counters at handler exit.
+ */
+void PERF_IsrExit(IRQn_Type IRQn)
+{
+    uint32_t State = 0U;
+
+    if (PERF_IsSelected(IRQn) == 0U)
+    {
+        return;
+    }
+
+    State = CORE_EnterCritical();
+
+    PERF_Sample();
+    if ((PERF_Depth != 0U) && (PERF_Stack[PERF_Depth - 1U] == (uint8_t)IRQn))
+    {
+        PERF_Stats[IRQn].Count++;
+        PERF_Depth--;
+    }
+
+    CORE_ExitCritical(State);
+}
+
+/**
+ * @brief Folds the counters into the running handler's statistics, to keep samples short.
+ */
+void PERF_Checkpoint(void)
+{
+    uint32_t State = CORE_EnterCritical();
+
+    PERF_Sample();
+
+    CORE_ExitCritical(State);
+}
+
+/**
+ * @brief Retrieves the statistics of one IRQ.
+ */
+uint8_t PERF_GetStats(IRQn_Type IRQn, PERF_IsrStats_t* Stats)
+{
+    uint32_t State = 0U;
+
+    if (Stats == 0)
+    {
+        return NULL_PTR_ERR;
+    }
+
+    State = CORE_EnterCritical();
+    *Stats = PERF_Stats[IRQn];
+    CORE_ExitCritical(State);
+
+    return OK;
+}
+
+/**
+ * @brief Retrieves the exception overhead.
+ */
+uint8_t PERF_GetOverhead(PERF_Overhead_t* Overhead)
+{
+    uint32_t State = 0U;
+
+    if (Overhead == 0)
+    {
+        return NULL_PTR_ERR;
+    }
+
+    State = CORE_EnterCritical();
+    *Overhead = PERF_Overhead;
+    CORE_ExitCritical(State);
+
+    return OK;
+}
+
+/**
+ * @brief Clears every statistic, keeping the selection.
+ */
+void PERF_Reset(void)
+{
+    uint32_t State = CORE_EnterCritical();
+    uint32_t Index = 0U;
+
+    for (Index = 0U; Index < NVIC_IRQ_COUNT; Index++)
+    {
+        PERF_Stats[Index].Count = 0U;
+        PERF_Stats[Index].Cycles = 0U;
+        PERF_Stats[Index].CpiCycles = 0U;
+        PERF_Stats[Index].LsuCycles = 0U;
+        PERF_Stats[Index].SleepCycles = 0U;
+        PERF_Stats[Index].Folded = 0U;
+        PERF_Stats[Index].Ambiguous = 0U;
+    }
+    PERF_Overhead.ExceptionCycles = 0U;
+    PERF_Overhead.Entries = 0U;
+    PERF_Overhead.Ambiguous = 0U;
+
+    PERF_Last.Cycles = DWT->CYCCNT;
+    PERF_Last.Cpi = DWT->CPICNT;
+    PERF_Last.Exc = DWT->EXCCNT;
+    PERF_Last.Sleep = DWT->SLEEPCNT;
+    PERF_Last.Lsu = DWT->LSUCNT;
+    PERF_Last.Fold = DWT->FOLDCNT;
+
+    CORE_ExitCritical(State);
+}
+
+/**
+ * @brief Reports whether an IRQ is profiled.
+ */
+static uint8_t PERF_IsSelected(IRQn_Type IRQn)
+{
+    return (uint8_t)((PERF_Selected[(uint32_t)IRQn / 32U] >> ((uint32_t)IRQn % 32U)) & 1U);
+}
+
+/**
+ * @brief Reads the counters and charges the differences since the previous sample.
+ *
+ * The 8-bit differences are taken modulo 256, exact only when less than 256 cycles have
+ * passed: no 8-bit counter moves faster than CYCCNT. EXCCNT goes to the overhead; the
+ * other differences go to the handler on top of the stack, or are dropped in thread mode.
+ */
+static void PERF_Sample(void)
+{
+    PERF_Snapshot_t Now;
+    PERF_IsrStats_t* Stats = 0;
+    uint32_t Cycles = 0U;
+
+    Now.Cycles = DWT->CYCCNT;
+    Now.Cpi = DWT->CPICNT;
+    Now.Exc = DWT->EXCCNT;
+    Now.Sleep = DWT->SLEEPCNT;
+    Now.Lsu = DWT->LSUCNT;
+    Now.Fold = DWT->FOLDCNT;
+
+    Cycles = Now.Cycles - PERF_Last.Cycles;
+    PERF_Overhead.ExceptionCycles += (Now.Exc - PERF_Last.Exc) & PERF_COUNTER8_MASK;
+    if (Cycles > PERF_COUNTER8_MASK)
+    {
+        PERF_Overhead.Ambiguous++;
+    }
+
+    if (PERF_Depth != 0U)
+    {
+        Stats = &PERF_Stats[PERF_Stack[PERF_Depth - 1U]];
+
+        Stats->Cycles += Cycles;
+        Stats->CpiCycles += (Now.Cpi - PERF_Last.Cpi) & PERF_COUNTER8_MASK;
+        Stats->LsuCycles += (Now.Lsu - PERF_Last.Lsu) & PERF_COUNTER8_MASK;
+        Stats->SleepCycles += (Now.Sleep - PERF_Last.Sleep) & PERF_COUNTER8_MASK;
+        Stats->Folded += (Now.Fold - PERF_Last.Fold) & PERF_COUNTER8_MASK;
+        if (Cycles > PERF_COUNTER8_MASK)
+        {
+            Stats->Ambiguous++;
+        }
+    }
+
+    PERF_Last = Now;
+}
@@ -0,0 +1,387 @@
+/**
+ * @file PRIOPROF_Program.c
+ * @brief Program for the binary interrupt priority profiles.
+ *
+ * This file provides the profile receiver, the validation, the flash storage and the
+ * diff-minimal apply step. Priorities are written with byte accesses to IPR: a byte write
+ * only touches its own IRQ, where the read-modify-write of a whole IPR word could undo a
+ * concurrent change to one of its three neighbours.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/PRIOPROF_Interface.h"
+#include "../Inc/PRIOPROF_Private.h"
+#include "../Inc/NVIC_Interface.h"
+#include "../../../LIB/STM32F446xx.h"
+#include "../../../LIB/CORE_Intrinsics.h"
+#include "../../../LIB/ErrType.h"
+
+static uint8_t PRIOPROF_RxBuffer[PRIOPROF_MAX_SIZE];
+static uint32_t PRIOPROF_RxLength = 0U;
+static uint32_t PRIOPROF_RxExpected = 0U;      /**< Profile size, known once the header is in */
+static uint32_t PRIOPROF_RxWindow = 0U;        /**< Last four bytes seen between profiles */
+static volatile PRIOPROF_RxStatus_t PRIOPROF_RxState = PRIOPROF_RX_WAITING;
+
+static uint32_t PRIOPROF_ReadWord(const uint8_t* Bytes);
+static uint32_t PRIOPROF_Crc32(const uint8_t* Data, uint32_t Length);
+static void PRIOPROF_FlashWait(void);
+static void PRIOPROF_FlushDataCache(void);
+
+_Static_assert((PRIOPROF_FLASH_SECTOR >= 1U) && (PRIOPROF_FLASH_SECTOR <= 7U),
+               "PRIOPROF_FLASH_SECTOR must be 1 to 7: sector 0 holds the vector table");
+
+/**
+ * @brief Restarts the receiver, dropping any partial or received profile.
+ */
+void PRIOPROF_RxReset(void)
+{
+    PRIOPROF_RxLength = 0U;
+    PRIOPROF_RxExpected = 0U;
+    PRIOPROF_RxWindow = 0U;
+    PRIOPROF_RxState = PRIOPROF_RX_WAITING;
+}
+
+/**
+ * @brief Feeds one received byte to the receiver.
+ *
+ * Between profiles the last four bytes are compared with the magic, so the receiver
+ * resynchronises on the next profile after line noise or a truncated transfer.
+ */
+PRIOPROF_RxStatus_t PRIOPROF_RxByte(uint8_t Byte)
+{
+    if (PRIOPROF_RxState == PRIOPROF_RX_READY)
+    {
+        return PRIOPROF_RX_READY;
+    }
+
+    if (PRIOPROF_RxLength == 0U)
+    {
+        PRIOPROF_RxWindow = (PRIOPROF_RxWindow >> 8) | ((uint32_t)Byte << 24);
+        if (PRIOPROF_RxWindow == PRIOPROF_MAGIC)
+        {
+            PRIOPROF_RxBuffer[0] = (uint8_t)PRIOPROF_MAGIC;
+            PRIOPROF_RxBuffer[1] = (uint8_t)(PRIOPROF_MAGIC >> 8);
+            PRIOPROF_RxBuffer[2] = (uint8_t)(PRIOPROF_MAGIC >> 16);
+            PRIOPROF_RxBuffer[3] = (uint8_t)(PRIOPROF_MAGIC >> 24);
+            PRIOPROF_RxLength = 4U;
+            PRIOPROF_RxWindow = 0U;
+            PRIOPROF_RxState = PRIOPROF_RX_RECEIVING;
+        }
+        return PRIOPROF_RxState;
+    }
+
+    PRIOPROF_RxBuffer[PRIOPROF_RxLength] = Byte;
+    PRIOPROF_RxLength++;
+
+    if (PRIOPROF_RxLength == PRIOPROF_FIXED_SIZE)
+    {
+        if ((PRIOPROF_RxBuffer[PRIOPROF_OFFSET_VERSION] != PRIOPROF_VERSION) ||
+            (PRIOPROF_RxBuffer[PRIOPROF_OFFSET_COUNT] > NVIC_IRQ_COUNT))
+        {
+            PRIOPROF_RxLength = 0U;
+            PRIOPROF_RxState = PRIOPROF_RX_ERROR;
+            return PRIOPROF_RxState;
+        }
+        PRIOPROF_RxExpected = PRIOPROF_SIZE(PRIOPROF_RxBuffer[PRIOPROF_OFFSET_COUNT]);
+    }
+
+    if ((PRIOPROF_RxLength > PRIOPROF_FIXED_SIZE) && (PRIOPROF_RxLength == PRIOPROF_RxExpected))
+    {
+        PRIOPROF_RxState = (PRIOPROF_Validate(PRIOPROF_RxBuffer, PRIOPROF_RxLength) == OK) ? PRIOPROF_RX_READY
+                                                                                             : PRIOPROF_RX_ERROR;
+        if (PRIOPROF_RxState == PRIOPROF_RX_ERROR)
+        {
+            PRIOPROF_RxLength = 0U;
+        }
+    }
+
+    return PRIOPROF_RxState;
+}
+
+/**
+ * @brief Feeds every byte waiting in a USART data register.
+ *
+ * Reading DR clears RXNE (and, after SR was read, an overrun flag).
+ */
+PRIOPROF_RxStatus_t PRIOPROF_RxUsart(USART_RegDef_t* USARTx)
+{
+    while ((USARTx->SR & (1UL << PRIOPROF_USART_SR_RXNE)) != 0U)
+    {
+        (void)PRIOPROF_RxByte((uint8_t)USARTx->DR);
+    }
+
+    return PRIOPROF_RxState;
+}
+
+/**
+ * @brief Returns the received profile.
+ */
+const uint8_t* PRIOPROF_GetReceived(uint32_t* Length)
+{
+    if (PRIOPROF_RxState != PRIOPROF_RX_READY)
+    {
+        return 0;
+    }
+    if (Length != 0)
+    {
+        *Length = PRIOPROF_RxLength;
+    }
+
+    return PRIOPROF_RxBuffer;
+}
+
+/**
+ * @brief Checks the layout and CRC of a profile.
+ *
+ * Beyond the CRC, the bitmap must select exactly Count existing IRQs and the unused high
+ * nibble of an odd-sized priority list must be zero.
+ */
+uint8_t PRIOPROF_Validate(const uint8_t* Profile, uint32_t Length)
+{
+    uint32_t Count = 0U;
+    uint32_t Size = 0U;
+    uint32_t Selected = 0U;
+    uint32_t Word = 0U;
+    uint32_t Bits = 0U;
+    uint32_t Index = 0U;
+
+    if (Profile == 0)
+    {
+        return NULL_PTR_ERR;
+    }
+    if ((Length < PRIOPROF_SIZE(0U)) || (PRIOPROF_ReadWord(Profile) != PRIOPROF_MAGIC) ||
+        (Profile[PRIOPROF_OFFSET_VERSION] != PRIOPROF_VERSION) || (Profile[PRIOPROF_OFFSET_RESERVED] != 0U) ||
+        (Profile[PRIOPROF_OFFSET_RESERVED + 1U] != 0U))
+    {
+        return NOK;
+    }
+
+    Count = Profile[PRIOPROF_OFFSET_COUNT];
+    Size = PRIOPROF_SIZE(Count);
+    if ((Count > NVIC_IRQ_COUNT) || (Length < Size))
+    {
+        return NOK;
+    }
+
+    for (Word = 0U; Word < PRIOPROF_BITMAP_WORDS; Word++)
+    {
+        Bits = PRIOPROF_ReadWord(&Profile[PRIOPROF_OFFSET_BITMAP + (4U * Word)]);
+        for (Index = 0U; Index < 32U; Index++)
+        {
+            if ((Bits & (1UL << Index)) != 0U)
+            {
+                if (((32U * Word) + Index) >= NVIC_IRQ_COUNT)
+                {
+                    return NOK;
+                }
+                Selected++;
+            }
+        }
+    }
+    if ((Selected != Count) ||
+        (((Count & 1U) != 0U) && ((Profile[PRIOPROF_HEADER_SIZE + (Count / 2U)] & 0xF0U) != 0U)))
+    {
+        return NOK;
+    }
+
+    if (PRIOPROF_Crc32(Profile, Size - 4U) != PRIOPROF_ReadWord(&Profile[Size - 4U]))
+    {
+        return NOK;
+    }
+
+    return OK;
+}
+
+/**
+ * @brief Erases the profile flash sector and programs a validated profile into it.
+ */
+uint8_t PRIOPROF_Store(const uint8_t* Profile, uint32_t Length)
+{
+    volatile uint32_t* Destination = (volatile uint32_t*)PRIOPROF_FLASH_ADDRESS;
+    uint32_t Size = 0U;
+    uint32_t Word = 0U;
+    uint32_t Index = 0U;
+    uint32_t Byte = 0U;
+    uint8_t Status = OK;
+
+    Status = PRIOPROF_Validate(Profile, Length);
+    if (Status != OK)
+    {
+        return Status;
+    }
+    Size = PRIOPROF_SIZE(Profile[PRIOPROF_OFFSET_COUNT]);
+
+    if ((FLASH_REG->CR & (1UL << PRIOPROF_FLASH_CR_LOCK)) != 0U)
+    {
+        FLASH_REG->KEYR = PRIOPROF_FLASH_KEY1;
+        FLASH_REG->KEYR = PRIOPROF_FLASH_KEY2;
+    }
+    PRIOPROF_FlashWait();
+    FLASH_REG->SR = PRIOPROF_FLASH_SR_ERRORS;   /**< Clear stale error flags, write 1 to clear */
+
+    /* Sector erase */
+    FLASH_REG->CR = (1UL << PRIOPROF_FLASH_CR_SER) | (PRIOPROF_FLASH_SECTOR << PRIOPROF_FLASH_CR_SNB) |
+                    (PRIOPROF_FLASH_PSIZE_X32 << PRIOPROF_FLASH_CR_PSIZE);
+    FLASH_REG->CR |= (1UL << PRIOPROF_FLASH_CR_STRT);
+    PRIOPROF_FlashWait();
+
+    /* Word programming, the last word padded with erased bytes */
+    if ((FLASH_REG->SR & PRIOPROF_FLASH_SR_ERRORS) == 0U)
+    {
+        FLASH_REG->CR = (1UL << PRIOPROF_FLASH_CR_PG) | (PRIOPROF_FLASH_PSIZE_X32 << PRIOPROF_FLASH_CR_PSIZE);
+        for (Index = 0U; Index < Size; Index += 4U)
+        {
+            Word = 0U;
+            for (Byte = 0U; Byte < 4U; Byte++)
+            {
+                Word |= (uint32_t)(((Index + Byte) < Size) ? Profile[Index + Byte] : 0xFFU) << (8U * Byte);
+            }
+            Destination[Index / 4U] = Word;
+            PRIOPROF_FlashWait();
+        }
+    }
+
+    FLASH_REG->CR = (1UL << PRIOPROF_FLASH_CR_LOCK);
+
+    /* The data cache may still hold lines of the sector read before the erase */
+    PRIOPROF_FlushDataCache();
+
+    return (PRIOPROF_GetStored() != 0) ? OK : NOK;
+}
+
+/**
+ * @brief Returns the profile stored in flash.
+ */
+const uint8_t* PRIOPROF_GetStored(void)
+{
+    const uint8_t* Stored = (const uint8_t*)PRIOPROF_FLASH_ADDRESS;
+
+    return (PRIOPROF_Validate(Stored, PRIOPROF_MAX_SIZE) == OK) ? Stored : 0;
+}
+
+/**
+ * @brief Applies a validated profile, writing only the priorities that change.
+ *
+ * BASEPRI is only ever raised: a caller already running under a tighter mask keeps it.
+ * The barriers make the new priorities effective before lower levels are unmasked.
+ */
+uint8_t PRIOPROF_Apply(const uint8_t* Profile, uint8_t Ceiling, uint32_t* Changed)
+{
+    volatile uint8_t* Ipr = (volatile uint8_t*)NVIC->IPR;
+    uint32_t Count = 0U;
+    uint32_t Nibble = 0U;
+    uint32_t Bits = 0U;
+    uint32_t IRQn = 0U;
+    uint32_t Written = 0U;
+    uint8_t Priority = 0U;
+    uint32_t PreviousBasePri = 0U;
+    uint8_t Status = OK;
+
+    if (Profile == 0)
+    {
+        return NULL_PTR_ERR;
+    }
+    if (Ceiling > PRIOPROF_MAX_CEILING)
+    {
+        return NOK;   /**< BASEPRI would wrap to a lower ceiling, or to 0 and mask nothing */
+    }
+    Count = Profile[PRIOPROF_OFFSET_COUNT];
+    Status = (Count <= NVIC_IRQ_COUNT) ? PRIOPROF_Validate(Profile, PRIOPROF_SIZE(Count)) : NOK;
+    if (Status != OK)
+    {
+        return Status;
+    }
+
+    PreviousBasePri = CORE_GetBASEPRI();
+    if ((Ceiling != 0U) && ((PreviousBasePri == 0U) || (((uint32_t)Ceiling << 4) < PreviousBasePri)))
+    {
+        CORE_SetBASEPRI((uint32_t)Ceiling << 4);
+    }
+
+    for (IRQn = 0U; IRQn < NVIC_IRQ_COUNT; IRQn++)
+    {
+        if ((IRQn % 32U) == 0U)
+        {
+            Bits = PRIOPROF_ReadWord(&Profile[PRIOPROF_OFFSET_BITMAP + (IRQn / 8U)]);
+        }
+        if ((Bits & (1UL << (IRQn % 32U))) != 0U)
+        {
+            Priority = (uint8_t)((Profile[PRIOPROF_HEADER_SIZE + (Nibble / 2U)] >> (4U * (Nibble & 1U))) & 0x0FU);
+            Nibble++;
+            if ((Ipr[IRQn] >> 4) != Priority)
+            {
+                Ipr[IRQn] = (uint8_t)(Priority << 4);
+                Written++;
+            }
+        }
+    }
+
+    CORE_DSB();
+    CORE_ISB();
+    CORE_SetBASEPRI(PreviousBasePri);
+
+    if (Changed != 0)
+    {
+        *Changed = Written;
+    }
+
+    return OK;
+}
+
+/**
+ * @brief Reads a little-endian word from a byte stream, whatever its alignment.
+ */
+static uint32_t PRIOPROF_ReadWord(const uint8_t* Bytes)
+{
+    return (uint32_t)Bytes[0] | ((uint32_t)Bytes[1] << 8) | ((uint32_t)Bytes[2] << 16) | ((uint32_t)Bytes[3] << 24);
+}
+
+/**
+ * @brief CRC-32 (IEEE 802.3), bitwise: profiles are under a hundred bytes.
+ */
+static uint32_t PRIOPROF_Crc32(const uint8_t* Data, uint32_t Length)
+{
+    uint32_t Crc = 0xFFFFFFFFUL;
+    uint32_t Index = 0U;
+    uint32_t Bit = 0U;
+
+    for (Index = 0U; Index < Length; Index++)
+    {
+        Crc ^= Data[Index];
+        for (Bit = 0U; Bit < 8U; Bit++)
+        {
+            Crc = ((Crc & 1U) != 0U) ? ((Crc >> 1) ^ PRIOPROF_CRC32_POLY) : (Crc >> 1);
+        }
+    }
+
+    return ~Crc;
+}
+
+/**
+ * @brief Waits for the end of the current flash operation.
+ */
+static void PRIOPROF_FlashWait(void)
+{
+    while ((FLASH_REG->SR & (1UL << PRIOPROF_FLASH_SR_BSY)) != 0U)
+    {
+        /* Erase or program in progress */
+    }
+}
+
+/**
+ * @brief Invalidates the flash data cache, as FLASH_FlushCaches() of the ST HAL does.
+ *
+ * DCRST is only taken into account with the cache disabled; the previous DCEN state is
+ * restored afterwards.
+ */
+static void PRIOPROF_FlushDataCache(void)
+{
+    uint32_t Acr = FLASH_REG->ACR & ~(1UL << PRIOPROF_FLASH_ACR_DCRST);
+
+    FLASH_REG->ACR = Acr & ~(1UL << PRIOPROF_FLASH_ACR_DCEN);
+    FLASH_REG->ACR = (Acr & ~(1UL << PRIOPROF_FLASH_ACR_DCEN)) | (1UL << PRIOPROF_FLASH_ACR_DCRST);
+    FLASH_REG->ACR = Acr & ~(1UL << PRIOPROF_FLASH_ACR_DCEN);
+    FLASH_REG->ACR = Acr;
+}
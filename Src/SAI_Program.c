@@ -0,0 +1,362 @@
+/**
+ * @file SAI_Program.c
+ * @brief Program for the SAI audio streaming driver.
+ *
+ * This file provides the SAI/DMA configuration, the half/full transfer handling that
+ * pends the block processing interrupt, and the deadline and underrun instrumentation.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/SAI_Interface.h"
+#include "../Inc/SAI_Private.h"
+#include "../Inc/DMA_Interface.h"
+#include "../Inc/NVIC_Interface.h"
+#include "../../../LIB/STM32F446xx.h"
+#include "../../../LIB/ErrType.h"
+
+static SAI_Block_RegDef_t* SAI_GetBlock(SAI_Block_t Block);
+static void SAI_RecordUnderrun(SAI_Handle_t* Handle, uint32_t Now);
+static void SAI_ResetStats(SAI_DeadlineStats_t* Stats);
+
+/**
+ * @brief Configures the SAI block, its DMA stream and both interrupts.
+ *
+ * @param[out] Handle  Stream state.
+ * @param[in]  Config  Stream configuration.
+ * @return uint8_t OK on success, NULL_PTR_ERR or NOK on invalid arguments.
+ */
+uint8_t SAI_Init(SAI_Handle_t* Handle, const SAI_Config_t* Config)
+{
+    SAI_Block_RegDef_t* BlockReg = 0;
+    uint32_t SlotBits = 0U;
+    uint8_t Receive = 0U;
+    DMA_StreamConfig_t DmaConfig;
+
+    if ((Handle == 0) || (Config == 0) || (Config->Buffer == 0) || (Config->Process == 0))
+    {
+        return NULL_PTR_ERR;
+    }
+    if (((Config->SampleBits != 16U) && (Config->SampleBits != 32U)) || (Config->FramesPerBlock == 0U) ||
+        (Config->FramesPerBlock > SAI_MAX_FRAMES_PER_BLOCK) || (Config->SampleRateHz == 0U) ||
+        (Config->CoreClockHz == 0U) || (Config->DmaStream > 7U) || (Config->DmaPriority >= Config->ProcessPriority))
+    {
+        return NOK;
+    }
+
+    Handle->Config = *Config;
+    Handle->ReadyHalf = SAI_NO_HALF;
+    Handle->Busy = 0U;
+    Handle->BlockCycles = (uint32_t)(((uint64_t)Config->FramesPerBlock * Config->CoreClockHz) / Config->SampleRateHz);
+    SAI_ResetStats(&Handle->Stats);
+
+    /* Deadlines are measured with the DWT cycle counter */
+    COREDEBUG->DEMCR |= (1UL << COREDEBUG_DEMCR_TRCENA);
+    DWT->CTRL |= (1UL << DWT_CTRL_CYCCNTENA);
+
+    RCC_REG->APB2ENR |= (1UL << ((Config->Block < SAI2_BLOCK_A) ? SAI_RCC_APB2ENR_SAI1EN : SAI_RCC_APB2ENR_SAI2EN));
+    RCC_REG->AHB1ENR |= (1UL << SAI_RCC_AHB1ENR_DMA2EN);
+
+    BlockReg = SAI_GetBlock(Config->Block);
+    SlotBits = Config->SampleBits;
+    Receive = (uint8_t)((uint32_t)Config->Mode & 1U);
+
+    BlockReg->CR1 = 0U;
+    BlockReg->CR1 = ((uint32_t)Config->Mode << SAI_CR1_MODE)
+                  | ((uint32_t)((SlotBits == 16U) ? SAI_CR1_DS_16BIT : SAI_CR1_DS_32BIT) << SAI_CR1_DS)
+                  | ((uint32_t)Receive << SAI_CR1_CKSTR)
+                  | (((uint32_t)Config->MasterClockDiv & 0xFU) << SAI_CR1_MCKDIV);
+    BlockReg->CR2 = SAI_CR2_FTH_HALF | (1UL << SAI_CR2_FFLUSH);
+    BlockReg->FRCR = ((SlotBits * SAI_SLOTS) - 1U) | ((SlotBits - 1U) << SAI_FRCR_FSALL)
+                   | (1UL << SAI_FRCR_FSDEF) | (1UL << SAI_FRCR_FSOFF);
+    BlockReg->SLOTR = ((SAI_SLOTS - 1U) << SAI_SLOTR_NBSLOT) | (0x3UL << SAI_SLOTR_SLOTEN);
+    BlockReg->CLRFR = 0x7FU;
+    BlockReg->IMR = (1UL << SAI_SR_OVRUDR);
+
+    DmaConfig.Channel = Config->DmaChannel;
+    DmaConfig.Direction = (Receive != 0U) ? DMA_PERIPH_TO_MEM : DMA_MEM_TO_PERIPH;
+    DmaConfig.PeriphSize = (SlotBits == 16U) ? DMA_SIZE_HALFWORD : DMA_SIZE_WORD;
+    DmaConfig.MemSize = DmaConfig.PeriphSize;
+    DmaConfig.PeriphBurst = DMA_BURST_SINGLE;
+    DmaConfig.MemBurst = DMA_BURST_SINGLE;
+    DmaConfig.Priority = 3U;
+    DmaConfig.MemIncrement = 1U;
+    DmaConfig.Circular = 1U;
+    DmaConfig.PeriphFlowControl = 0U;
+    DmaConfig.FifoEnable = 1U;
+    DmaConfig.Interrupts = DMA_IT_HT | DMA_IT_TC | DMA_IT_TE;
+    DmaConfig.PeriphAddress = (uint32_t)&BlockReg->DR;
+    if (DMA_StreamInit(DMA_2, Config->DmaStream, &DmaConfig) != OK)
+    {
+        return NOK;
+    }
+
+    /* DMA above processing: a late block must never delay the detection of the next one */
+    NVIC_SetPriority(Config->DmaIRQ, Config->DmaPriority);
+    NVIC_SetPriority(Config->ProcessIRQ, Config->ProcessPriority);
+    NVIC_SetPriority((Config->Block < SAI2_BLOCK_A) ? SAI1 : SAI2, Config->DmaPriority);
+    NVIC_ClearPendingIRQ(Config->DmaIRQ);
+    NVIC_ClearPendingIRQ(Config->ProcessIRQ);
+    NVIC_EnableIRQ(Config->DmaIRQ);
+    NVIC_EnableIRQ(Config->ProcessIRQ);
+    NVIC_EnableIRQ((Config->Block < SAI2_BLOCK_A) ? SAI1 : SAI2);
+
+    return OK;
+}
+
+/**
+ * @brief Starts the circular DMA and enables the audio block.
+ *
+ * @param[in,out] Handle  Stream state.
+ */
+void SAI_Start(SAI_Handle_t* Handle)
+{
+    SAI_Block_RegDef_t* BlockReg = SAI_GetBlock(Handle->Config.Block);
+
+    Handle->ReadyHalf = SAI_NO_HALF;
+    Handle->Busy = 0U;
+
+    DMA_StreamStart(DMA_2, Handle->Config.DmaStream, (uint32_t)Handle->Config.Buffer,
+                    (uint16_t)(2U * SAI_SLOTS * Handle->Config.FramesPerBlock));
+
+    BlockReg->CR1 |= (1UL << SAI_CR1_DMAEN);
+    BlockReg->CR1 |= (1UL << SAI_CR1_SAIEN);
+}
+
+/**
+ * @brief Disables the audio block and stops its DMA stream.
+ *
+ * @param[in,out] Handle  Stream state.
+ */
+void SAI_Stop(SAI_Handle_t* Handle)
+{
+    SAI_Block_RegDef_t* BlockReg = SAI_GetBlock(Handle->Config.Block);
+
+    BlockReg->CR1 &= ~(1UL << SAI_CR1_SAIEN);
+    while ((BlockReg->CR1 & (1UL << SAI_CR1_SAIEN)) != 0U)
+    {
+        /* SAIEN reads back 1 until the current frame has ended */
+    }
+    DMA_StreamStop(DMA_2, Handle->Config.DmaStream);
+    BlockReg->CR1 &= ~(1UL << SAI_CR1_DMAEN);
+    BlockReg->CR2 |= (1UL << SAI_CR2_FFLUSH);
+}
+
+/**
+ * @brief Copies the deadline instrumentation and optionally resets it.
+ *
+ * Both stream interrupts are disabled for the copy so that it is consistent.
+ *
+ * @param[in,out] Handle  Stream state.
+ * @param[out]    Stats   Destination of the statistics.
+ * @param[in]     Reset   1 to restart the measurement window.
+ */
+void SAI_GetStats(SAI_Handle_t* Handle, SAI_DeadlineStats_t* Stats, uint8_t Reset)
+{
+    NVIC_DisableIRQ(Handle->Config.DmaIRQ);
+    NVIC_DisableIRQ(Handle->Config.ProcessIRQ);
+
+    *Stats = Handle->Stats;
+    if (Reset != 0U)
+    {
+        SAI_ResetStats(&Handle->Stats);
+    }
+
+    NVIC_EnableIRQ(Handle->Config.ProcessIRQ);
+    NVIC_EnableIRQ(Handle->Config.DmaIRQ);
+}
+
+/**
+ * @brief DMA half/full transfer handler, call it from the vector of Config.DmaIRQ.
+ *
+ * The half the DMA has just finished becomes the block to process. Its deadline is one
+ * block period later, when the DMA comes back to it.
+ *
+ * @param[in,out] Handle  Stream state.
+ */
+void SAI_DmaIRQHandler(SAI_Handle_t* Handle)
+{
+    uint32_t Now = DWT->CYCCNT;
+    uint32_t Flags = DMA_GetFlags(DMA_2, Handle->Config.DmaStream);
+    uint8_t Half = SAI_NO_HALF;
+
+    DMA_ClearFlags(DMA_2, Handle->Config.DmaStream, Flags);
+
+    if ((Flags & DMA_FLAG_TE) != 0U)
+    {
+        Handle->Stats.FifoErrors++;
+    }
+
+    if ((Flags & DMA_FLAG_TC) != 0U)
+    {
+        Half = 1U;
+    }
+    else if ((Flags & DMA_FLAG_HT) != 0U)
+    {
+        Half = 0U;
+    }
+    else
+    {
+        return;
+    }
+
+    Handle->Stats.Blocks++;
+
+    if ((Handle->ReadyHalf != SAI_NO_HALF) || (Handle->Busy != 0U) ||
+        ((Flags & (DMA_FLAG_HT | DMA_FLAG_TC)) == (DMA_FLAG_HT | DMA_FLAG_TC)))
+    {
+        SAI_RecordUnderrun(Handle, Now);
+    }
+
+    Handle->EventTime = Now;
+    Handle->ReadyHalf = Half;
+    NVIC_SetPendingIRQ(Handle->Config.ProcessIRQ);
+}
+
+/**
+ * @brief Block processing handler, call it from the vector of Config.ProcessIRQ.
+ *
+ * @param[in,out] Handle  Stream state.
+ */
+void SAI_ProcessIRQHandler(SAI_Handle_t* Handle)
+{
+    uint32_t Start = DWT->CYCCNT;
+    uint8_t Half = Handle->ReadyHalf;
+    uint32_t EventTime = Handle->EventTime;
+    uint32_t SampleCount = SAI_SLOTS * (uint32_t)Handle->Config.FramesPerBlock;
+    uint32_t SampleBytes = (uint32_t)Handle->Config.SampleBits / 8U;
+    uint32_t End = 0U;
+    uint32_t Cycles = 0U;
+    int32_t Slack = 0;
+
+    if (Half == SAI_NO_HALF)
+    {
+        return;
+    }
+    Handle->ReadyHalf = SAI_NO_HALF;
+    Handle->Busy = 1U;
+
+    Handle->Config.Process((uint8_t*)Handle->Config.Buffer + (Half * SampleCount * SampleBytes),
+                           (uint16_t)SampleCount, Handle->Config.Context);
+
+    End = DWT->CYCCNT;
+    Handle->Busy = 0U;
+
+    Slack = (int32_t)((EventTime + Handle->BlockCycles) - End);
+    Cycles = End - Start;
+
+    Handle->Stats.Processed++;
+    Handle->Stats.LastSlack = Slack;
+    if (Slack < Handle->Stats.MinSlack)
+    {
+        Handle->Stats.MinSlack = Slack;
+    }
+    if ((Start - EventTime) > Handle->Stats.MaxStartLatency)
+    {
+        Handle->Stats.MaxStartLatency = Start - EventTime;
+    }
+    if (Cycles > Handle->Stats.MaxProcessCycles)
+    {
+        Handle->Stats.MaxProcessCycles = Cycles;
+    }
+}
+
+/**
+ * @brief SAI interrupt handler counting FIFO overrun/underrun.
+ *
+ * @param[in,out] Handle  Stream state.
+ */
+void SAI_IRQHandler(SAI_Handle_t* Handle)
+{
+    SAI_Block_RegDef_t* BlockReg = SAI_GetBlock(Handle->Config.Block);
+
+    if ((BlockReg->SR & (1UL << SAI_SR_OVRUDR)) != 0U)
+    {
+        BlockReg->CLRFR = (1UL << SAI_SR_OVRUDR);
+        Handle->Stats.FifoErrors++;
+    }
+}
+
+/**
+ * @brief Returns the register block of an audio block.
+ */
+static SAI_Block_RegDef_t* SAI_GetBlock(SAI_Block_t Block)
+{
+    SAI_RegDef_t* Sai = (Block < SAI2_BLOCK_A) ? SAI_1 : SAI_2;
+
+    return &Sai->Block[(uint32_t)Block & 1U];
+}
+
+/**
+ * @brief Snapshots the NVIC state of an underrun and blames an interrupt.
+ *
+ * Any active interrupt at or above the processing priority kept the block from being
+ * processed. When several are nested, the outermost one (lowest urgency) is blamed:
+ * it started first and the others only added to its delay. With none active, the
+ * processing itself is blamed if it was still running.
+ */
+static void SAI_RecordUnderrun(SAI_Handle_t* Handle, uint32_t Now)
+{
+    SAI_Underrun_t* Record = &Handle->Stats.LastUnderrun;
+    uint32_t Word = 0U;
+    uint32_t Bit = 0U;
+    uint32_t Priority = 0U;
+    uint32_t CulpritPriority = 0U;
+    IRQn_Type IRQn;
+
+    Record->Timestamp = Now;
+    Record->Block = Handle->Stats.Blocks;
+    Record->ProcessingRunning = Handle->Busy;
+    Record->Culprit = SAI_NO_CULPRIT;
+
+    for (Word = 0U; Word < NVIC_IRQ_WORDS; Word++)
+    {
+        Record->Active[Word] = NVIC->IABR[Word];
+        Record->Pending[Word] = NVIC->ISPR[Word];
+    }
+
+    for (Word = 0U; Word < NVIC_IRQ_WORDS; Word++)
+    {
+        for (Bit = 0U; (Bit < 32U) && ((Record->Active[Word] >> Bit) != 0U); Bit++)
+        {
+            IRQn = (IRQn_Type)((Word * 32U) + Bit);
+            if (((Record->Active[Word] & (1UL << Bit)) == 0U) ||
+                (IRQn == Handle->Config.DmaIRQ) || (IRQn == Handle->Config.ProcessIRQ))
+            {
+                continue;
+            }
+
+            Priority = NVIC_GetPriority(IRQn);
+            if ((Priority <= Handle->Config.ProcessPriority) &&
+                ((Record->Culprit == SAI_NO_CULPRIT) || (Priority >= CulpritPriority)))
+            {
+                Record->Culprit = (int32_t)IRQn;
+                CulpritPriority = Priority;
+            }
+        }
+    }
+
+    if ((Record->Culprit == SAI_NO_CULPRIT) && (Handle->Busy != 0U))
+    {
+        Record->Culprit = (int32_t)Handle->Config.ProcessIRQ;
+    }
+
+    Handle->Stats.Underruns++;
+}
+
+/**
+ * @brief Restarts the measurement window.
+ */
+static void SAI_ResetStats(SAI_DeadlineStats_t* Stats)
+{
+    Stats->Blocks = 0U;
+    Stats->Processed = 0U;
+    Stats->LastSlack = 0;
+    Stats->MinSlack = 0x7FFFFFFF;
+    Stats->MaxStartLatency = 0U;
+    Stats->MaxProcessCycles = 0U;
+    Stats->Underruns = 0U;
+    Stats->FifoErrors = 0U;
+    Stats->LastUnderrun.Culprit = SAI_NO_CULPRIT;
+}
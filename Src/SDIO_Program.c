@@ -0,0 +1,491 @@
+/**
+ * @file SDIO_Program.c
+ * @brief Program for the SDIO SD card block driver.
+ *
+ * This file provides the SD identification sequence and the interrupt driven engine
+ * that runs queued multi-block DMA transfers (CMD18/CMD25 closed by CMD12).
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/SDIO_Interface.h"
+#include "../Inc/SDIO_Private.h"
+#include "../Inc/DMA_Interface.h"
+#include "../Inc/NVIC_Interface.h"
+#include "../../../LIB/STM32F446xx.h"
+#include "../../../LIB/ErrType.h"
+
+static SDIO_Request_t SDIO_Queue[SDIO_QUEUE_DEPTH];  /**< Request ring, filled by tasks, drained by the SDIO ISR */
+static volatile uint8_t SDIO_QueueHead = 0U;          /**< Next free slot, written by the producer only */
+static volatile uint8_t SDIO_QueueTail = 0U;          /**< Oldest request, written by the ISR only */
+
+static volatile SDIO_State_t SDIO_State = SDIO_STATE_IDLE;
+static uint32_t SDIO_Rca = 0U;               /**< Relative card address, already shifted to bits 31:16 */
+static uint8_t  SDIO_BlockAddressing = 0U;   /**< 1 for SDHC/SDXC, 0 when SDSC expects byte addresses */
+static uint8_t  SDIO_CardMayBeBusy = 0U;     /**< Set after a write, the card may still be programming */
+static uint8_t  SDIO_DataDone = 0U;          /**< DATAEND received for the active request */
+static uint8_t  SDIO_DmaDone = 0U;           /**< DMA transfer complete received for the active request */
+static uint8_t  SDIO_RequestStatus = OK;     /**< Status reported for the active request */
+
+static uint8_t SDIO_SendCommand(uint8_t Index, uint32_t Argument, uint8_t Response);
+static uint8_t SDIO_SwitchHighSpeed(void);
+static uint8_t SDIO_Submit(uint32_t BlockAddress, uint8_t* Buffer, uint16_t BlockCount, uint8_t Write,
+                           SDIO_Callback_t Callback, void* Context);
+static void SDIO_IssueCommandIT(uint8_t Index, uint32_t Argument);
+static void SDIO_StartNext(void);
+static void SDIO_StartData(void);
+static void SDIO_Complete(void);
+
+/**
+ * @brief Powers the SDIO peripheral and identifies the card.
+ *
+ * @param[in] Config  Driver configuration.
+ * @return uint8_t OK when a card was identified, NOK or NULL_PTR_ERR otherwise.
+ */
+uint8_t SDIO_Init(const SDIO_Config_t* Config)
+{
+    uint8_t ErrorState = OK;
+    uint8_t Version2 = 0U;      /**< Card answered CMD8, it understands HCS */
+    uint32_t Retries = 0U;
+    uint32_t Ocr = 0U;
+
+    if (Config == 0)
+    {
+        return NULL_PTR_ERR;
+    }
+
+    RCC_REG->APB2ENR |= (1UL << SDIO_RCC_APB2ENR_SDIOEN);
+    RCC_REG->AHB1ENR |= (1UL << SDIO_RCC_AHB1ENR_DMA2EN);
+
+    NVIC_DisableIRQ(SDIO);
+    NVIC_DisableIRQ(DMA2_Stream3);
+
+    SDIO_REG->CLKCR = (SDIO_INIT_CLKDIV | (1UL << SDIO_CLKCR_CLKEN));
+    SDIO_REG->POWER = SDIO_POWER_ON;
+    SDIO_REG->MASK = 0U;
+    SDIO_REG->ICR = SDIO_STATIC_FLAGS;
+
+    (void)SDIO_SendCommand(SDIO_CMD0_GO_IDLE, 0U, SDIO_RESP_NONE);
+
+    if ((SDIO_SendCommand(SDIO_CMD8_SEND_IF_COND, SDIO_CMD8_PATTERN, SDIO_RESP_SHORT) == OK) &&
+        ((SDIO_REG->RESP[0] & 0xFFFU) == SDIO_CMD8_PATTERN))
+    {
+        Version2 = 1U;
+    }
+
+    /* ACMD41 until the card leaves its power-up busy state; R3 carries no CRC */
+    do
+    {
+        if (SDIO_SendCommand(SDIO_CMD55_APP_CMD, 0U, SDIO_RESP_SHORT) != OK)
+        {
+            return NOK;
+        }
+        (void)SDIO_SendCommand(SDIO_ACMD41_SEND_OP_COND, (Version2 != 0U) ? SDIO_ACMD41_ARG : (SDIO_ACMD41_ARG & ~(1UL << SDIO_OCR_CCS)),
+                               SDIO_RESP_SHORT);
+        Ocr = SDIO_REG->RESP[0];
+        Retries++;
+    } while (((Ocr & (1UL << SDIO_OCR_READY)) == 0U) && (Retries < SDIO_ACMD41_RETRIES));
+
+    if ((Ocr & (1UL << SDIO_OCR_READY)) == 0U)
+    {
+        return NOK;
+    }
+    SDIO_BlockAddressing = (uint8_t)((Ocr >> SDIO_OCR_CCS) & 1U);
+
+    if ((SDIO_SendCommand(SDIO_CMD2_ALL_SEND_CID, 0U, SDIO_RESP_LONG) != OK) ||
+        (SDIO_SendCommand(SDIO_CMD3_SEND_RCA, 0U, SDIO_RESP_SHORT) != OK))
+    {
+        return NOK;
+    }
+    SDIO_Rca = SDIO_REG->RESP[0] & 0xFFFF0000UL;
+
+    if ((SDIO_SendCommand(SDIO_CMD7_SELECT, SDIO_Rca, SDIO_RESP_SHORT) != OK) ||
+        (SDIO_SendCommand(SDIO_CMD16_SET_BLOCKLEN, SDIO_BLOCK_SIZE, SDIO_RESP_SHORT) != OK) ||
+        (SDIO_SendCommand(SDIO_CMD55_APP_CMD, SDIO_Rca, SDIO_RESP_SHORT) != OK) ||
+        (SDIO_SendCommand(SDIO_ACMD6_BUS_WIDTH, 2U, SDIO_RESP_SHORT) != OK))
+    {
+        return NOK;
+    }
+
+    /* 4-bit bus at 24 MHz, or 48 MHz through the divider bypass once the card runs high speed */
+    SDIO_REG->CLKCR = (SDIO_TRANSFER_CLKDIV | (1UL << SDIO_CLKCR_CLKEN) | (1UL << SDIO_CLKCR_WIDBUS));
+    if ((Config->HighSpeed != 0U) && (SDIO_SwitchHighSpeed() == OK))
+    {
+        SDIO_REG->CLKCR |= (1UL << SDIO_CLKCR_BYPASS);
+    }
+
+    /* Control interrupts must always win over card traffic: both lines share one low priority */
+    NVIC_SetPriority(SDIO, Config->IrqPriority);
+    NVIC_SetPriority(DMA2_Stream3, Config->IrqPriority);
+    NVIC_ClearPendingIRQ(SDIO);
+    NVIC_ClearPendingIRQ(DMA2_Stream3);
+    NVIC_EnableIRQ(SDIO);
+    NVIC_EnableIRQ(DMA2_Stream3);
+
+    SDIO_State = SDIO_STATE_IDLE;
+
+    return ErrorState;
+}
+
+/**
+ * @brief Queues a multi-block read.
+ */
+uint8_t SDIO_ReadBlocks(uint32_t BlockAddress, uint8_t* Buffer, uint16_t BlockCount,
+                        SDIO_Callback_t Callback, void* Context)
+{
+    return SDIO_Submit(BlockAddress, Buffer, BlockCount, 0U, Callback, Context);
+}
+
+/**
+ * @brief Queues a multi-block write.
+ */
+uint8_t SDIO_WriteBlocks(uint32_t BlockAddress, const uint8_t* Buffer, uint16_t BlockCount,
+                         SDIO_Callback_t Callback, void* Context)
+{
+    return SDIO_Submit(BlockAddress, (uint8_t*)Buffer, BlockCount, 1U, Callback, Context);
+}
+
+/**
+ * @brief Reports whether requests are queued or in progress.
+ *
+ * @return uint8_t 1 while the driver is busy, 0 when idle.
+ */
+uint8_t SDIO_IsBusy(void)
+{
+    return (uint8_t)(((SDIO_State != SDIO_STATE_IDLE) || (SDIO_QueueHead != SDIO_QueueTail)) ? 1U : 0U);
+}
+
+/**
+ * @brief SDIO interrupt handler, advances the transfer state machine.
+ *
+ * A software pend with no flag set is a kick from SDIO_Submit() asking the idle
+ * engine to pick up the queue.
+ */
+void SDIO_IRQHandler(void)
+{
+    uint32_t Status = SDIO_REG->STA & SDIO_REG->MASK;
+
+    SDIO_REG->ICR = Status & SDIO_STATIC_FLAGS;
+
+    switch (SDIO_State)
+    {
+    case SDIO_STATE_IDLE:
+        SDIO_StartNext();
+        break;
+
+    case SDIO_STATE_WAIT_READY:
+        if ((Status & SDIO_CMD_ERRORS) != 0U)
+        {
+            SDIO_RequestStatus = NOK;
+            SDIO_Complete();
+        }
+        else if ((Status & (1UL << SDIO_STA_CMDREND)) != 0U)
+        {
+            uint32_t CardStatus = SDIO_REG->RESP[0];
+
+            if ((((CardStatus >> SDIO_R1_STATE) & 0xFU) == SDIO_R1_STATE_TRAN) &&
+                ((CardStatus & (1UL << SDIO_R1_READY_FOR_DATA)) != 0U))
+            {
+                SDIO_CardMayBeBusy = 0U;
+                SDIO_StartData();
+            }
+            else
+            {
+                SDIO_IssueCommandIT(SDIO_CMD13_SEND_STATUS, SDIO_Rca);   /**< Still programming, ask again */
+            }
+        }
+        break;
+
+    case SDIO_STATE_DATA_CMD:
+        if (((Status & SDIO_CMD_ERRORS) != 0U) ||
+            (((Status & (1UL << SDIO_STA_CMDREND)) != 0U) && ((SDIO_REG->RESP[0] & SDIO_R1_ERRORS) != 0U)))
+        {
+            SDIO_RequestStatus = NOK;
+            SDIO_Complete();
+        }
+        else if ((Status & (1UL << SDIO_STA_CMDREND)) != 0U)
+        {
+            SDIO_State = SDIO_STATE_DATA;
+            SDIO_REG->MASK = SDIO_DATA_ERRORS | (1UL << SDIO_STA_DATAEND);
+            if (SDIO_Queue[SDIO_QueueTail].Write != 0U)
+            {
+                /* Writes start the data path only once the card accepted CMD25 */
+                SDIO_REG->DCTRL = (1UL << SDIO_DCTRL_DTEN) | (1UL << SDIO_DCTRL_DMAEN) |
+                                  (SDIO_DCTRL_BLOCK_512 << SDIO_DCTRL_DBLOCKSIZE);
+            }
+        }
+        break;
+
+    case SDIO_STATE_DATA:
+        if ((Status & SDIO_DATA_ERRORS) != 0U)
+        {
+            SDIO_RequestStatus = NOK;
+            DMA_StreamStop(DMA_2, SDIO_DMA_STREAM);
+            SDIO_DmaDone = 1U;
+        }
+        if ((Status & (SDIO_DATA_ERRORS | (1UL << SDIO_STA_DATAEND))) != 0U)
+        {
+            SDIO_DataDone = 1U;
+            SDIO_State = SDIO_STATE_STOP;
+            SDIO_IssueCommandIT(SDIO_CMD12_STOP, 0U);
+        }
+        break;
+
+    case SDIO_STATE_STOP:
+        if ((Status & SDIO_CMD_ERRORS) != 0U)
+        {
+            SDIO_RequestStatus = NOK;
+        }
+        if ((Status & (SDIO_CMD_ERRORS | (1UL << SDIO_STA_CMDREND))) != 0U)
+        {
+            SDIO_REG->MASK = 0U;
+            if (SDIO_DmaDone != 0U)
+            {
+                SDIO_Complete();
+            }
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief DMA2 Stream3 interrupt handler, completes the DMA side of a transfer.
+ *
+ * Runs at the same priority as SDIO_IRQHandler(), so the two never preempt each other
+ * and the shared state needs no locking. A read is only complete once the DMA has
+ * drained its FIFO, which may happen after DATAEND.
+ */
+void DMA2_Stream3_IRQHandler(void)
+{
+    uint32_t Flags = DMA_GetFlags(DMA_2, SDIO_DMA_STREAM);
+
+    DMA_ClearFlags(DMA_2, SDIO_DMA_STREAM, Flags);
+
+    if ((Flags & (DMA_FLAG_TE | DMA_FLAG_FE)) != 0U)
+    {
+        SDIO_RequestStatus = NOK;
+    }
+    if ((Flags & (DMA_FLAG_TC | DMA_FLAG_TE)) != 0U)
+    {
+        SDIO_DmaDone = 1U;
+        if ((SDIO_State == SDIO_STATE_STOP) && (SDIO_REG->MASK == 0U))
+        {
+            SDIO_Complete();   /**< CMD12 already answered */
+        }
+    }
+}
+
+/**
+ * @brief Sends a command and polls for its completion (identification phase only).
+ *
+ * @param[in] Index     Command index.
+ * @param[in] Argument  Command argument.
+ * @param[in] Response  SDIO_RESP_NONE, SDIO_RESP_SHORT or SDIO_RESP_LONG.
+ * @return uint8_t OK when the command completed, NOK on timeout or CRC failure.
+ */
+static uint8_t SDIO_SendCommand(uint8_t Index, uint32_t Argument, uint8_t Response)
+{
+    uint32_t Timeout = SDIO_CMD_TIMEOUT;
+    uint32_t DoneMask = (Response == SDIO_RESP_NONE) ? (1UL << SDIO_STA_CMDSENT)
+                                                     : ((1UL << SDIO_STA_CMDREND) | SDIO_CMD_ERRORS);
+    uint32_t Status = 0U;
+
+    SDIO_REG->ICR = SDIO_STATIC_FLAGS;
+    SDIO_REG->ARG = Argument;
+    SDIO_REG->CMD = (uint32_t)Index | ((uint32_t)Response << SDIO_CMD_WAITRESP) | (1UL << SDIO_CMD_CPSMEN);
+
+    do
+    {
+        Status = SDIO_REG->STA;
+        Timeout--;
+    } while (((Status & DoneMask) == 0U) && (Timeout != 0U));
+
+    SDIO_REG->ICR = SDIO_STATIC_FLAGS;
+
+    return (uint8_t)((((Status & DoneMask) != 0U) && ((Status & (1UL << SDIO_STA_CTIMEOUT)) == 0U) &&
+                      (((Status & (1UL << SDIO_STA_CCRCFAIL)) == 0U) || (Index == SDIO_ACMD41_SEND_OP_COND)))
+                     ? OK : NOK);
+}
+
+/**
+ * @brief Switches the card to high speed mode with CMD6.
+ *
+ * Reads the 64-byte switch status by polling the FIFO; byte 16 carries the function
+ * selected for group 1, which must read back as 1 (high speed).
+ *
+ * @return uint8_t OK when the card now runs high speed, NOK otherwise.
+ */
+static uint8_t SDIO_SwitchHighSpeed(void)
+{
+    uint32_t SwitchStatus[SDIO_CMD6_STATUS_BYTES / 4U];
+    uint8_t Index = 0U;
+    uint32_t Timeout = SDIO_CMD_TIMEOUT;
+
+    SDIO_REG->DTIMER = SDIO_DATA_TIMEOUT;
+    SDIO_REG->DLEN = SDIO_CMD6_STATUS_BYTES;
+    SDIO_REG->DCTRL = (1UL << SDIO_DCTRL_DTEN) | (1UL << SDIO_DCTRL_DTDIR) | (6UL << SDIO_DCTRL_DBLOCKSIZE);
+
+    if (SDIO_SendCommand(SDIO_CMD6_SWITCH_FUNC, SDIO_CMD6_HIGH_SPEED, SDIO_RESP_SHORT) != OK)
+    {
+        SDIO_REG->DCTRL = 0U;
+        return NOK;
+    }
+
+    while ((Index < (SDIO_CMD6_STATUS_BYTES / 4U)) && (Timeout != 0U))
+    {
+        if ((SDIO_REG->STA & SDIO_DATA_ERRORS) != 0U)
+        {
+            break;
+        }
+        if ((SDIO_REG->STA & (1UL << SDIO_STA_RXDAVL)) != 0U)
+        {
+            SwitchStatus[Index] = SDIO_REG->FIFO;
+            Index++;
+        }
+        Timeout--;
+    }
+
+    SDIO_REG->ICR = SDIO_STATIC_FLAGS;
+
+    /* Status is sent MSB first: byte 16 is the low byte of word 4 */
+    return (uint8_t)(((Index == (SDIO_CMD6_STATUS_BYTES / 4U)) && ((SwitchStatus[4] & 0x0FU) == 1U)) ? OK : NOK);
+}
+
+/**
+ * @brief Adds a request to the queue and kicks the engine through a software pend.
+ *
+ * The queue has a single producer: requests must be submitted from one context.
+ */
+static uint8_t SDIO_Submit(uint32_t BlockAddress, uint8_t* Buffer, uint16_t BlockCount, uint8_t Write,
+                           SDIO_Callback_t Callback, void* Context)
+{
+    uint8_t NextHead = (uint8_t)((SDIO_QueueHead + 1U) % SDIO_QUEUE_DEPTH);
+    SDIO_Request_t* Request = &SDIO_Queue[SDIO_QueueHead];
+
+    if ((Buffer == 0) || (BlockCount == 0U) || ((((uint32_t)Buffer) & 3U) != 0U) || (NextHead == SDIO_QueueTail))
+    {
+        return NOK;
+    }
+
+    Request->BlockAddress = BlockAddress;
+    Request->Buffer = Buffer;
+    Request->BlockCount = BlockCount;
+    Request->Write = Write;
+    Request->Callback = Callback;
+    Request->Context = Context;
+
+    SDIO_QueueHead = NextHead;   /**< Publishes the slot to the ISR */
+
+    /* The ISR owns the hardware; pending it lets an idle engine start from interrupt context */
+    NVIC_SetPendingIRQ(SDIO);
+
+    return OK;
+}
+
+/**
+ * @brief Sends a command with its completion reported by interrupt.
+ */
+static void SDIO_IssueCommandIT(uint8_t Index, uint32_t Argument)
+{
+    SDIO_REG->MASK = (1UL << SDIO_STA_CMDREND) | SDIO_CMD_ERRORS;
+    SDIO_REG->ARG = Argument;
+    SDIO_REG->CMD = (uint32_t)Index | ((uint32_t)SDIO_RESP_SHORT << SDIO_CMD_WAITRESP) | (1UL << SDIO_CMD_CPSMEN);
+}
+
+/**
+ * @brief Starts the oldest queued request, if any.
+ */
+static void SDIO_StartNext(void)
+{
+    if (SDIO_QueueTail == SDIO_QueueHead)
+    {
+        return;
+    }
+
+    SDIO_RequestStatus = OK;
+    SDIO_DataDone = 0U;
+    SDIO_DmaDone = 0U;
+
+    if (SDIO_CardMayBeBusy != 0U)
+    {
+        SDIO_State = SDIO_STATE_WAIT_READY;
+        SDIO_IssueCommandIT(SDIO_CMD13_SEND_STATUS, SDIO_Rca);
+    }
+    else
+    {
+        SDIO_StartData();
+    }
+}
+
+/**
+ * @brief Arms the DMA and the data path, then sends CMD18 or CMD25.
+ */
+static void SDIO_StartData(void)
+{
+    const SDIO_Request_t* Request = &SDIO_Queue[SDIO_QueueTail];
+    uint32_t Address = (SDIO_BlockAddressing != 0U) ? Request->BlockAddress : (Request->BlockAddress * SDIO_BLOCK_SIZE);
+    DMA_StreamConfig_t DmaConfig =
+    {
+        .Channel = SDIO_DMA_CHANNEL,
+        .Direction = (Request->Write != 0U) ? DMA_MEM_TO_PERIPH : DMA_PERIPH_TO_MEM,
+        .PeriphSize = DMA_SIZE_WORD,
+        .MemSize = DMA_SIZE_WORD,
+        .PeriphBurst = DMA_BURST_INC4,
+        .MemBurst = DMA_BURST_INC4,
+        .Priority = 3U,
+        .MemIncrement = 1U,
+        .Circular = 0U,
+        .PeriphFlowControl = 1U,
+        .FifoEnable = 1U,
+        .Interrupts = DMA_IT_TC | DMA_IT_TE | DMA_IT_FE,
+        .PeriphAddress = (uint32_t)&SDIO_REG->FIFO
+    };
+
+    (void)DMA_StreamInit(DMA_2, SDIO_DMA_STREAM, &DmaConfig);
+    DMA_StreamStart(DMA_2, SDIO_DMA_STREAM, (uint32_t)Request->Buffer, 0U);
+
+    SDIO_REG->DTIMER = SDIO_DATA_TIMEOUT;
+    SDIO_REG->DLEN = (uint32_t)Request->BlockCount * SDIO_BLOCK_SIZE;
+
+    if (Request->Write == 0U)
+    {
+        /* Reads need the data path armed before the card starts sending */
+        SDIO_REG->DCTRL = (1UL << SDIO_DCTRL_DTEN) | (1UL << SDIO_DCTRL_DTDIR) | (1UL << SDIO_DCTRL_DMAEN) |
+                          (SDIO_DCTRL_BLOCK_512 << SDIO_DCTRL_DBLOCKSIZE);
+    }
+
+    SDIO_State = SDIO_STATE_DATA_CMD;
+    SDIO_IssueCommandIT((Request->Write != 0U) ? SDIO_CMD25_WRITE_MULTI : SDIO_CMD18_READ_MULTI, Address);
+}
+
+/**
+ * @brief Retires the active request, reports it and starts the next one.
+ */
+static void SDIO_Complete(void)
+{
+    const SDIO_Request_t* Request = &SDIO_Queue[SDIO_QueueTail];
+    SDIO_Callback_t Callback = Request->Callback;
+    void* Context = Request->Context;
+
+    if ((SDIO_DmaDone == 0U) || (SDIO_DataDone == 0U))
+    {
+        DMA_StreamStop(DMA_2, SDIO_DMA_STREAM);
+    }
+    SDIO_REG->DCTRL = 0U;
+    SDIO_REG->MASK = 0U;
+    SDIO_CardMayBeBusy = (uint8_t)(SDIO_CardMayBeBusy | Request->Write);
+
+    SDIO_QueueTail = (uint8_t)((SDIO_QueueTail + 1U) % SDIO_QUEUE_DEPTH);
+    SDIO_State = SDIO_STATE_IDLE;
+
+    if (Callback != 0)
+    {
+        Callback(SDIO_RequestStatus, Context);
+    }
+
+    SDIO_StartNext();
+}
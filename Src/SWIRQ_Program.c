@@ -0,0 +1,153 @@
+/**
+ * @file SWIRQ_Program.c
+ * @brief Program for the token-bucket admission of software-triggered interrupts.
+ *
+ * This file refills a line's bucket lazily, from the CYCCNT cycles elapsed since the last
+ * refill, at each post and tick. The bucket and counters are updated with interrupts
+ * masked for a few instructions, since producers at several levels may post to the same
+ * line.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/SWIRQ_Interface.h"
+#include "../Inc/SWIRQ_Private.h"
+#include "../Inc/NVIC_Interface.h"
+#include "../../../LIB/STM32F446xx.h"
+#include "../../../LIB/CORE_Intrinsics.h"
+#include "../../../LIB/ErrType.h"
+
+static void SWIRQ_Refill(SWIRQ_Line_t* Line);
+static void SWIRQ_Raise(SWIRQ_Line_t* Line);
+
+/**
+ * @brief Sets up a line with a full bucket.
+ */
+uint8_t SWIRQ_Init(SWIRQ_Line_t* Line, IRQn_Type IRQn, uint32_t Priority, uint32_t Capacity, uint32_t RefillCycles)
+{
+    if (Line == 0)
+    {
+        return NULL_PTR_ERR;
+    }
+    if ((Capacity == 0U) || (RefillCycles == 0U))
+    {
+        return NOK;
+    }
+
+    COREDEBUG->DEMCR |= (1UL << COREDEBUG_DEMCR_TRCENA);
+    DWT->CTRL |= (1UL << DWT_CTRL_CYCCNTENA);
+
+    *Line = (SWIRQ_Line_t){ 0 };
+    Line->IRQn = IRQn;
+    Line->Capacity = Capacity;
+    Line->RefillCycles = RefillCycles;
+    Line->Tokens = Capacity;
+    Line->LastRefill = DWT->CYCCNT;
+
+    NVIC_SetPriority(IRQn, Priority);
+    NVIC_EnableIRQClean(IRQn);
+
+    return OK;
+}
+
+/**
+ * @brief Posts work to the line.
+ *
+ * A post finding the IRQ pending spends no token: the pending run covers it. An admitted
+ * post also covers the held ones, so Held is cleared with it.
+ */
+uint8_t SWIRQ_Post(SWIRQ_Line_t* Line)
+{
+    uint8_t Status = OK;
+    uint32_t State = CORE_EnterCritical();
+
+    if (NVIC_GetPendingIRQ(Line->IRQn) != 0U)
+    {
+        Line->Posts++;
+    }
+    else
+    {
+        SWIRQ_Refill(Line);
+        if (Line->Tokens != 0U)
+        {
+            Line->Posts += Line->Held + 1U;
+            Line->Held = 0U;
+            SWIRQ_Raise(Line);
+        }
+        else
+        {
+            Line->Held++;
+            Line->Throttled++;
+            Status = NOK;
+        }
+    }
+    CORE_ExitCritical(State);
+
+    return Status;
+}
+
+/**
+ * @brief Raises the line for its held posts once a token is back.
+ */
+void SWIRQ_Tick(SWIRQ_Line_t* Line)
+{
+    uint32_t State = CORE_EnterCritical();
+
+    SWIRQ_Refill(Line);
+    if ((Line->Held != 0U) && (Line->Tokens != 0U))
+    {
+        Line->Posts += Line->Held;
+        Line->Held = 0U;
+        SWIRQ_Raise(Line);
+    }
+    CORE_ExitCritical(State);
+}
+
+/**
+ * @brief Takes the posts the handler's run covers.
+ */
+uint32_t SWIRQ_Take(SWIRQ_Line_t* Line)
+{
+    uint32_t Posts = 0U;
+    uint32_t State = CORE_EnterCritical();
+
+    Posts = Line->Posts;
+    Line->Posts = 0U;
+    CORE_ExitCritical(State);
+
+    return Posts;
+}
+
+/**
+ * @brief Adds the tokens earned since the last refill.
+ *
+ * LastRefill moves by whole tokens only, so the remainder keeps accruing. A full bucket
+ * earns nothing: LastRefill is then brought to now.
+ */
+static void SWIRQ_Refill(SWIRQ_Line_t* Line)
+{
+    uint32_t Now = DWT->CYCCNT;
+    uint32_t Earned = (Now - Line->LastRefill) / Line->RefillCycles;
+
+    if ((Line->Tokens + Earned >= Line->Capacity) || (Line->Tokens + Earned < Line->Tokens))
+    {
+        Line->Tokens = Line->Capacity;
+        Line->LastRefill = Now;
+    }
+    else
+    {
+        Line->Tokens += Earned;
+        Line->LastRefill += Earned * Line->RefillCycles;
+    }
+}
+
+/**
+ * @brief Spends a token and triggers the IRQ through STIR.
+ */
+static void SWIRQ_Raise(SWIRQ_Line_t* Line)
+{
+    Line->Tokens--;
+    Line->Raised++;
+    NVIC->STIR = (uint32_t)Line->IRQn & SWIRQ_STIR_INTID_MASK;
+}
@@ -0,0 +1,239 @@
+/**
+ * @file TRACEENC_Program.c
+ * @brief Program for the compressed encoder of the ISR trace stream.
+ *
+ * This file reads the trace ring of TRACE_Program.c behind its own cursor and writes the
+ * token stream described in TRACEENC_Interface.h. The encoder mirrors the decoder's
+ * nesting state to predict the IRQ of each record.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/TRACEENC_Interface.h"
+#include "../Inc/TRACEENC_Private.h"
+#include "../Inc/TRACE_Interface.h"
+#include "../../../LIB/STM32F446xx.h"
+#include "../../../LIB/CORE_Intrinsics.h"
+#include "../../../LIB/ErrType.h"
+
+static TRACEENC_State_t TRACEENC_State;
+
+static uint32_t TRACEENC_PutVarint(uint8_t* Out, uint32_t Value);
+static uint32_t TRACEENC_PutSync(uint8_t* Out, uint32_t Timestamp);
+static uint32_t TRACEENC_PutOverrun(uint8_t* Out, uint32_t Lost);
+static uint32_t TRACEENC_PutRecord(uint8_t* Out, const TRACE_Record_t* Record);
+
+/**
+ * @brief Starts encoding from the current end of the trace.
+ */
+uint8_t TRACEENC_Init(uint8_t Shift)
+{
+    const TRACE_Buffer_t* Buffer = TRACE_GetBuffer();
+
+    if ((Buffer == 0) || (Shift > TRACEENC_MAX_SHIFT))
+    {
+        return NOK;
+    }
+
+    TRACEENC_State.Tail = Buffer->Head;
+    TRACEENC_State.Clock = 0U;
+    TRACEENC_State.Shift = Shift;
+    TRACEENC_State.NeedSync = 1U;
+    TRACEENC_State.Depth = 0U;
+    TRACEENC_State.LastEnter = TRACEENC_NO_IRQ;
+    TRACEENC_State.Lost = 0U;
+
+    return OK;
+}
+
+/**
+ * @brief Encodes pending trace records into a buffer, within a cycle budget.
+ *
+ * Each record is copied out of the ring with interrupts masked, the same lock the trace
+ * writer takes, so a record is never read half overwritten. Records overwritten before
+ * they were read are reported by an OVERRUN token followed by a SYNC.
+ */
+uint32_t TRACEENC_Encode(uint8_t* Out, uint32_t Space, uint32_t CycleBudget)
+{
+    const TRACE_Buffer_t* Buffer = TRACE_GetBuffer();
+    uint32_t Start = DWT->CYCCNT;
+    uint32_t Written = 0U;
+    uint32_t Head = 0U;
+    uint32_t State = 0U;
+    TRACE_Record_t Record;
+
+    if ((Buffer == 0) || (Out == 0))
+    {
+        return 0U;
+    }
+
+    while (((Written + TRACEENC_MAX_TOKEN) <= Space) && ((DWT->CYCCNT - Start) < CycleBudget))
+    {
+        State = CORE_EnterCritical();
+        Head = Buffer->Head;
+        if ((Head - TRACEENC_State.Tail) > TRACE_RECORD_COUNT)
+        {
+            TRACEENC_State.Lost += (Head - TRACEENC_State.Tail) - TRACE_RECORD_COUNT;
+            TRACEENC_State.Tail = Head - TRACE_RECORD_COUNT;
+        }
+        if (Head == TRACEENC_State.Tail)
+        {
+            CORE_ExitCritical(State);
+            break;
+        }
+        Record = Buffer->Records[TRACEENC_State.Tail & (TRACE_RECORD_COUNT - 1U)];
+        CORE_ExitCritical(State);
+
+        if (TRACEENC_State.Lost != 0U)
+        {
+            Written += TRACEENC_PutOverrun(&Out[Written], TRACEENC_State.Lost);
+            TRACEENC_State.Lost = 0U;
+            TRACEENC_State.NeedSync = 1U;
+        }
+        else if (TRACEENC_State.NeedSync != 0U)
+        {
+            Written += TRACEENC_PutSync(&Out[Written], Record.Timestamp);
+        }
+        else
+        {
+            Written += TRACEENC_PutRecord(&Out[Written], &Record);
+            TRACEENC_State.Tail++;
+        }
+    }
+
+    return Written;
+}
+
+/**
+ * @brief Returns the number of trace records not encoded yet.
+ */
+uint32_t TRACEENC_Backlog(void)
+{
+    const TRACE_Buffer_t* Buffer = TRACE_GetBuffer();
+
+    return (Buffer == 0) ? 0U : (Buffer->Head - TRACEENC_State.Tail);
+}
+
+/**
+ * @brief Writes a varint, 7 bits per byte, least significant group first.
+ *
+ * @return uint32_t Bytes written, 5 at most.
+ */
+static uint32_t TRACEENC_PutVarint(uint8_t* Out, uint32_t Value)
+{
+    uint32_t Length = 0U;
+
+    while (Value >= 0x80U)
+    {
+        Out[Length] = (uint8_t)(Value | 0x80U);
+        Value >>= 7;
+        Length++;
+    }
+    Out[Length] = (uint8_t)Value;
+
+    return Length + 1U;
+}
+
+/**
+ * @brief Writes a SYNC token at the record's timestamp and clears the nesting state.
+ *
+ * Handlers entered before the SYNC exit without a prediction and carry their IRQ byte.
+ */
+static uint32_t TRACEENC_PutSync(uint8_t* Out, uint32_t Timestamp)
+{
+    Out[0] = (uint8_t)TRACEENC_CTRL_TOKEN;
+    Out[1] = (uint8_t)TRACEENC_CTRL_SYNC;
+    Out[2] = TRACEENC_State.Shift;
+    Out[3] = (uint8_t)Timestamp;
+    Out[4] = (uint8_t)(Timestamp >> 8);
+    Out[5] = (uint8_t)(Timestamp >> 16);
+    Out[6] = (uint8_t)(Timestamp >> 24);
+
+    TRACEENC_State.Clock = Timestamp;
+    TRACEENC_State.Depth = 0U;
+    TRACEENC_State.LastEnter = TRACEENC_NO_IRQ;
+    TRACEENC_State.NeedSync = 0U;
+
+    return 7U;
+}
+
+/**
+ * @brief Writes an OVERRUN token with the number of records lost.
+ */
+static uint32_t TRACEENC_PutOverrun(uint8_t* Out, uint32_t Lost)
+{
+    Out[0] = (uint8_t)TRACEENC_CTRL_TOKEN;
+    Out[1] = (uint8_t)TRACEENC_CTRL_OVERRUN;
+
+    return 2U + TRACEENC_PutVarint(&Out[2], Lost);
+}
+
+/**
+ * @brief Writes the token of one record and updates the mirrored decoder state.
+ *
+ * A record stamped before the clock gets a zero delta: taken modulo 2^32, its negative
+ * delta would move both clocks about 2^32 cycles forward for the rest of the stream.
+ */
+static uint32_t TRACEENC_PutRecord(uint8_t* Out, const TRACE_Record_t* Record)
+{
+    uint32_t Elapsed = Record->Timestamp - TRACEENC_State.Clock;
+    uint32_t Delta = ((int32_t)Elapsed < 0) ? 0U : (Elapsed >> TRACEENC_State.Shift);
+    uint8_t Exit = (uint8_t)(Record->Event == (uint8_t)TRACE_ISR_EXIT);
+    uint8_t Predicted = TRACEENC_NO_IRQ;
+    uint8_t Flags = 0U;
+    uint32_t Length = 1U;
+
+    if (Exit != 0U)
+    {
+        Predicted = (TRACEENC_State.Depth != 0U) ? TRACEENC_State.Stack[TRACEENC_State.Depth - 1U] : TRACEENC_NO_IRQ;
+        Flags |= TRACEENC_FLAG_EXIT;
+    }
+    else
+    {
+        Predicted = TRACEENC_State.LastEnter;
+    }
+    if (Record->IRQn == Predicted)
+    {
+        Flags |= TRACEENC_FLAG_PREDICTED;
+    }
+
+    /* The clock moves by whole units, so the rounding error does not build up */
+    TRACEENC_State.Clock += Delta << TRACEENC_State.Shift;
+
+    if (Delta < TRACEENC_DELTA_ESCAPE)
+    {
+        Out[0] = (uint8_t)((Delta << 2) | Flags);
+    }
+    else
+    {
+        Out[0] = (uint8_t)((TRACEENC_DELTA_ESCAPE << 2) | Flags);
+        Length += TRACEENC_PutVarint(&Out[1], (Delta - TRACEENC_DELTA_ESCAPE) + TRACEENC_CTRL_CODES);
+    }
+
+    if ((Flags & TRACEENC_FLAG_PREDICTED) == 0U)
+    {
+        Out[Length] = Record->IRQn;
+        Length++;
+    }
+
+    if (Exit == 0U)
+    {
+        TRACEENC_State.LastEnter = Record->IRQn;
+        if (TRACEENC_State.Depth < TRACEENC_MAX_DEPTH)
+        {
+            TRACEENC_State.Stack[TRACEENC_State.Depth] = Record->IRQn;
+            TRACEENC_State.Depth++;
+        }
+    }
+    else if (TRACEENC_State.Depth != 0U)
+    {
+        TRACEENC_State.Depth--;
+    }
+    else
+    {
+        /* Exit of a handler entered before the last SYNC */
+    }
+
+    return Length;
+}
@@ -0,0 +1,245 @@
+/**
+ * @file TRACE_Program.c
+ * @brief Program for the ISR trace and per-IRQ timing statistics.
+ *
+ * This file provides the trace recording functions, the placement of the buffer in
+ * main or backup SRAM, and the boot-time recovery of the previous run's trace.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/TRACE_Interface.h"
+#include "../Inc/TRACE_Private.h"
+#include "../../../LIB/STM32F446xx.h"
+#include "../../../LIB/CORE_Intrinsics.h"
+#include "../../../LIB/ErrType.h"
+
+_Static_assert(sizeof(TRACE_Buffer_t) <= BKPSRAM_SIZE, "TRACE_Buffer_t must fit the 4 KB backup SRAM");
+_Static_assert((TRACE_RECORD_COUNT & (TRACE_RECORD_COUNT - 1U)) == 0U, "TRACE_RECORD_COUNT must be a power of two");
+
+static TRACE_Buffer_t TRACE_RamBuffer TRACE_RETAINED;   /**< Buffer used with TRACE_IN_SRAM */
+
+static TRACE_Buffer_t* TRACE_Buffer = 0;                 /**< Active buffer */
+static volatile TRACE_State_t TRACE_State = TRACE_STATE_OFF;
+static uint32_t TRACE_EntryTime[NVIC_IRQ_COUNT];         /**< Entry timestamp of each running handler */
+static uint8_t TRACE_Depth = 0U;                          /**< Nesting depth of traced handlers */
+
+static void TRACE_Clear(void);
+static uint32_t TRACE_Record(IRQn_Type IRQn, TRACE_Event_t Event);
+
+/**
+ * @brief Selects the trace memory and validates what it holds.
+ *
+ * The validation only reads the four header words, so it costs the same whatever the
+ * buffer size and can run early in the boot.
+ *
+ * @param[in] Location  Memory holding the trace buffer.
+ * @return uint8_t 1 when a previous trace was found, 0 otherwise.
+ */
+uint8_t TRACE_Init(TRACE_Location_t Location)
+{
+    uint8_t Previous = 0U;
+    uint32_t Timeout = TRACE_BRR_TIMEOUT;
+
+    COREDEBUG->DEMCR |= (1UL << COREDEBUG_DEMCR_TRCENA);
+    DWT->CTRL |= (1UL << DWT_CTRL_CYCCNTENA);
+
+    if (Location == TRACE_IN_BACKUP_SRAM)
+    {
+        /* Backup SRAM writes need the PWR clock and the backup domain write protection lifted */
+        RCC_REG->APB1ENR |= (1UL << TRACE_RCC_APB1ENR_PWREN);
+        PWR->CR |= (1UL << TRACE_PWR_CR_DBP);
+        RCC_REG->AHB1ENR |= (1UL << TRACE_RCC_AHB1ENR_BKPSRAMEN);
+
+        /* Without the backup regulator the backup SRAM is lost in Standby and on VBAT */
+        PWR->CSR |= (1UL << PWR_CSR_BRE);
+        while (((PWR->CSR & (1UL << PWR_CSR_BRR)) == 0U) && (Timeout != 0U))
+        {
+            Timeout--;
+        }
+        TRACE_Buffer = (TRACE_Buffer_t*)BKPSRAM_BASE_ADDRESS;
+    }
+    else
+    {
+        TRACE_Buffer = &TRACE_RamBuffer;
+    }
+
+    if ((TRACE_Buffer->Magic == TRACE_MAGIC) && (TRACE_Buffer->Layout == TRACE_LAYOUT) &&
+        (TRACE_Buffer->HeaderCheck == TRACE_HEADER_CHECK(TRACE_MAGIC, TRACE_LAYOUT)) && (TRACE_Buffer->Head != 0U))
+    {
+        Previous = 1U;
+        TRACE_State = TRACE_STATE_HELD;
+    }
+    else
+    {
+        TRACE_Clear();
+    }
+
+    return Previous;
+}
+
+/**
+ * @brief Streams the previous run's trace, then clears it and starts recording.
+ *
+ * @param[in] Write  Byte sink.
+ * @return uint32_t Number of bytes streamed, 0 when there was nothing to recover.
+ */
+uint32_t TRACE_StreamPrevious(TRACE_Write_t Write)
+{
+    uint32_t Header[4];
+    uint32_t Count = 0U;
+    uint32_t Oldest = 0U;
+    uint32_t Bytes = 0U;
+
+    if ((TRACE_State != TRACE_STATE_HELD) || (Write == 0))
+    {
+        return 0U;
+    }
+
+    Count = (TRACE_Buffer->Head < TRACE_RECORD_COUNT) ? TRACE_Buffer->Head : TRACE_RECORD_COUNT;
+    Oldest = (TRACE_Buffer->Head < TRACE_RECORD_COUNT) ? 0U : (TRACE_Buffer->Head & (TRACE_RECORD_COUNT - 1U));
+
+    Header[0] = TRACE_Buffer->Magic;
+    Header[1] = TRACE_Buffer->Layout;
+    Header[2] = TRACE_Buffer->HeaderCheck;
+    Header[3] = Count;
+    Write((const uint8_t*)Header, sizeof(Header));
+    Write((const uint8_t*)TRACE_Buffer->Stats, sizeof(TRACE_Buffer->Stats));
+    Bytes = sizeof(Header) + sizeof(TRACE_Buffer->Stats);
+
+    /* Oldest record first: the tail of the ring, then its start */
+    Write((const uint8_t*)&TRACE_Buffer->Records[Oldest], (Count - Oldest) * sizeof(TRACE_Record_t));
+    if (Oldest != 0U)
+    {
+        Write((const uint8_t*)&TRACE_Buffer->Records[0], Oldest * sizeof(TRACE_Record_t));
+    }
+    Bytes += Count * sizeof(TRACE_Record_t);
+
+    TRACE_Clear();
+
+    return Bytes;
+}
+
+/**
+ * @brief Drops the previous run's trace and starts recording.
+ */
+void TRACE_Discard(void)
+{
+    if (TRACE_Buffer != 0)
+    {
+        TRACE_Clear();
+    }
+}
+
+/**
+ * @brief Records the entry of an interrupt handler.
+ *
+ * @param[in] IRQn  Interrupt being served.
+ */
+void TRACE_IsrEnter(IRQn_Type IRQn)
+{
+    if (TRACE_State == TRACE_STATE_RECORDING)
+    {
+        TRACE_EntryTime[IRQn] = TRACE_Record(IRQn, TRACE_ISR_ENTER);
+    }
+}
+
+/**
+ * @brief Records the exit of an interrupt handler.
+ *
+ * An IRQ never preempts itself, so its statistics entry is only ever written by its
+ * own handler and needs no locking.
+ *
+ * @param[in] IRQn  Interrupt being served.
+ */
+void TRACE_IsrExit(IRQn_Type IRQn)
+{
+    uint32_t Cycles = 0U;
+    TRACE_IsrStats_t* Stats = 0;
+
+    if (TRACE_State == TRACE_STATE_RECORDING)
+    {
+        Cycles = TRACE_Record(IRQn, TRACE_ISR_EXIT) - TRACE_EntryTime[IRQn];
+        Stats = &TRACE_Buffer->Stats[IRQn];
+        Stats->Count++;
+        Stats->InclusiveCycles += Cycles;
+        if (Cycles > Stats->MaxInclusiveCycles)
+        {
+            Stats->MaxInclusiveCycles = Cycles;
+        }
+    }
+}
+
+/**
+ * @brief Returns the trace buffer, for on-target inspection.
+ *
+ * @return const TRACE_Buffer_t* The active buffer, or NULL before TRACE_Init().
+ */
+const TRACE_Buffer_t* TRACE_GetBuffer(void)
+{
+    return TRACE_Buffer;
+}
+
+/**
+ * @brief Empties the buffer, stamps a valid header and starts recording.
+ *
+ * The magic is written last so that a reset in the middle leaves an invalid header.
+ */
+static void TRACE_Clear(void)
+{
+    uint32_t Index = 0U;
+
+    TRACE_State = TRACE_STATE_OFF;
+    TRACE_Buffer->Magic = 0U;
+    TRACE_Buffer->Head = 0U;
+    for (Index = 0U; Index < NVIC_IRQ_COUNT; Index++)
+    {
+        TRACE_Buffer->Stats[Index].Count = 0U;
+        TRACE_Buffer->Stats[Index].InclusiveCycles = 0U;
+        TRACE_Buffer->Stats[Index].MaxInclusiveCycles = 0U;
+    }
+    TRACE_Buffer->Layout = TRACE_LAYOUT;
+    TRACE_Buffer->HeaderCheck = TRACE_HEADER_CHECK(TRACE_MAGIC, TRACE_LAYOUT);
+    TRACE_Buffer->Magic = TRACE_MAGIC;
+
+    TRACE_Depth = 0U;
+    TRACE_State = TRACE_STATE_RECORDING;
+}
+
+/**
+ * @brief Appends a record; the timestamp, slot reservation and fill are atomic against nesting.
+ *
+ * CYCCNT is read inside the critical section: read before it, a nested handler could
+ * append a later timestamp first and the ring would go back in time.
+ *
+ * @return uint32_t Timestamp of the record.
+ */
+static uint32_t TRACE_Record(IRQn_Type IRQn, TRACE_Event_t Event)
+{
+    uint32_t State = CORE_EnterCritical();
+    uint32_t Timestamp = DWT->CYCCNT;
+    uint32_t Head = TRACE_Buffer->Head;
+    TRACE_Record_t* Record = &TRACE_Buffer->Records[Head & (TRACE_RECORD_COUNT - 1U)];
+
+    if (Event == TRACE_ISR_ENTER)
+    {
+        TRACE_Depth++;
+    }
+
+    Record->Timestamp = Timestamp;
+    Record->IRQn = (uint8_t)IRQn;
+    Record->Event = (uint8_t)Event;
+    Record->Depth = TRACE_Depth;
+    Record->Reserved = 0U;
+    TRACE_Buffer->Head = Head + 1U;
+
+    if ((Event == TRACE_ISR_EXIT) && (TRACE_Depth != 0U))
+    {
+        TRACE_Depth--;
+    }
+
+    CORE_ExitCritical(State);
+
+    return Timestamp;
+}
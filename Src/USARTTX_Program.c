@@ -0,0 +1,244 @@
+/**
+ * @file USARTTX_Program.c
+ * @brief Program for the scatter-gather DMA transmit engine of USART1/2/3/6.
+ *
+ * This file keeps the queued records in a ring: USARTTX_Send() claims slots with
+ * interrupts masked for a few instructions, since producers may preempt each other, and
+ * starts the DMA when it is idle. The DMA interrupt retires the slots of the transfer
+ * that ended, completes a chain when its last slot is among them, and starts the next
+ * transfer at once, so the USART keeps transmitting while records are queued.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/USARTTX_Interface.h"
+#include "../Inc/USARTTX_Private.h"
+#include "../Inc/DMA_Interface.h"
+#include "../Inc/NVIC_Interface.h"
+#include "../../../LIB/STM32F446xx.h"
+#include "../../../LIB/CORE_Intrinsics.h"
+#include "../../../LIB/ErrType.h"
+
+static const USARTTX_PortDef_t USARTTX_Ports[USARTTX_PORT_COUNT] =
+{
+    { USART_1, DMA_2, 7U, 4U, DMA2_Stream7, 1U, USARTTX_RCC_APB2ENR_USART1EN, USARTTX_RCC_AHB1ENR_DMA2EN },
+    { USART_2, DMA_1, 6U, 4U, DMA1_Stream6, 0U, USARTTX_RCC_APB1ENR_USART2EN, USARTTX_RCC_AHB1ENR_DMA1EN },
+    { USART_3, DMA_1, 3U, 4U, DMA1_Stream3, 0U, USARTTX_RCC_APB1ENR_USART3EN, USARTTX_RCC_AHB1ENR_DMA1EN },
+    { USART_6, DMA_2, 6U, 5U, DMA2_Stream6, 1U, USARTTX_RCC_APB2ENR_USART6EN, USARTTX_RCC_AHB1ENR_DMA2EN },
+};
+
+static void USARTTX_StartNext(USARTTX_Handle_t* Handle);
+
+/**
+ * @brief Configures the USART transmitter, its DMA stream and the DMA interrupt.
+ */
+uint8_t USARTTX_Init(USARTTX_Handle_t* Handle, const USARTTX_Config_t* Config)
+{
+    const USARTTX_PortDef_t* Port = 0;
+    DMA_StreamConfig_t DmaConfig;
+
+    if ((Handle == 0) || (Config == 0) || (Config->Slots == 0))
+    {
+        return NULL_PTR_ERR;
+    }
+    if ((Config->Port >= USARTTX_PORT_COUNT) || (Config->SlotCount == 0U) ||
+        ((Config->SlotCount & (Config->SlotCount - 1U)) != 0U))
+    {
+        return NOK;
+    }
+
+    Port = &USARTTX_Ports[Config->Port];
+    *Handle = (USARTTX_Handle_t){ 0 };
+    Handle->Config = *Config;
+
+    if (Port->Apb2 != 0U)
+    {
+        RCC_REG->APB2ENR |= (1UL << Port->UsartEnBit);
+    }
+    else
+    {
+        RCC_REG->APB1ENR |= (1UL << Port->UsartEnBit);
+    }
+    RCC_REG->AHB1ENR |= (1UL << Port->DmaEnBit);
+
+    Port->Usart->CR1 = 0U;
+    Port->Usart->BRR = Config->Brr;
+    Port->Usart->CR3 = (1UL << USARTTX_CR3_DMAT);
+    Port->Usart->CR1 = (1UL << USARTTX_CR1_UE) | (1UL << USARTTX_CR1_TE);
+
+    DmaConfig.Channel = Port->Channel;
+    DmaConfig.Direction = DMA_MEM_TO_PERIPH;
+    DmaConfig.PeriphSize = DMA_SIZE_BYTE;
+    DmaConfig.MemSize = DMA_SIZE_BYTE;
+    DmaConfig.PeriphBurst = DMA_BURST_SINGLE;
+    DmaConfig.MemBurst = DMA_BURST_SINGLE;
+    DmaConfig.Priority = 1U;
+    DmaConfig.MemIncrement = 1U;
+    DmaConfig.Circular = 0U;
+    DmaConfig.PeriphFlowControl = 0U;
+    DmaConfig.FifoEnable = 0U;
+    DmaConfig.Interrupts = DMA_IT_TC | DMA_IT_TE;
+    DmaConfig.PeriphAddress = (uint32_t)&Port->Usart->DR;
+    if (DMA_StreamInit(Port->Dma, Port->Stream, &DmaConfig) != OK)
+    {
+        return NOK;
+    }
+
+    NVIC_SetPriority(Port->DmaIRQ, Config->DmaPriority);
+    NVIC_EnableIRQClean(Port->DmaIRQ);
+
+    return OK;
+}
+
+/**
+ * @brief Queues a chain of records.
+ *
+ * The chain is queued whole or not at all. The producer that finds the engine idle
+ * marks it busy inside the critical section, so only one of them starts the DMA.
+ */
+uint8_t USARTTX_Send(USARTTX_Handle_t* Handle, const USARTTX_Record_t* Records, uint16_t Count, void* ChainContext)
+{
+    USARTTX_Slot_t* Slot = 0;
+    uint16_t Mask = (uint16_t)(Handle->Config.SlotCount - 1U);
+    uint16_t Index = 0U;
+    uint8_t Start = 0U;
+    uint32_t State = 0U;
+
+    if (Records == 0)
+    {
+        return NULL_PTR_ERR;
+    }
+    if (Count == 0U)
+    {
+        return NOK;
+    }
+    for (Index = 0U; Index < Count; Index++)
+    {
+        if ((Records[Index].Data == 0) || (Records[Index].Length == 0U))
+        {
+            return NOK;
+        }
+    }
+
+    State = CORE_EnterCritical();
+    if ((uint16_t)(Handle->Config.SlotCount - (uint16_t)(Handle->Head - Handle->Tail)) < Count)
+    {
+        CORE_ExitCritical(State);
+        return NOK;
+    }
+    for (Index = 0U; Index < Count; Index++)
+    {
+        Slot = &Handle->Config.Slots[(uint16_t)(Handle->Head + Index) & Mask];
+        Slot->Address = (uint32_t)Records[Index].Data;
+        Slot->Length = Records[Index].Length;
+        Slot->EndOfChain = (Index == (uint16_t)(Count - 1U)) ? 1U : 0U;
+        Slot->ChainContext = ChainContext;
+    }
+    Handle->Head = (uint16_t)(Handle->Head + Count);
+    if (Handle->Busy == 0U)
+    {
+        Handle->Busy = 1U;
+        Start = 1U;
+    }
+    CORE_ExitCritical(State);
+
+    if (Start != 0U)
+    {
+        USARTTX_StartNext(Handle);
+    }
+
+    return OK;
+}
+
+/**
+ * @brief DMA stream handler: completes the transfer and starts the next one.
+ *
+ * The emptiness check and the clearing of Busy form one critical section: a producer
+ * preempting between them would otherwise queue a chain that nobody starts.
+ */
+void USARTTX_DmaIRQHandler(USARTTX_Handle_t* Handle)
+{
+    const USARTTX_PortDef_t* Port = &USARTTX_Ports[Handle->Config.Port];
+    uint32_t Flags = DMA_GetFlags(Port->Dma, Port->Stream);
+    const USARTTX_Slot_t* Last = 0;
+    uint32_t State = 0U;
+    uint8_t Idle = 0U;
+
+    DMA_ClearFlags(Port->Dma, Port->Stream, Flags);
+
+    if (Handle->InFlight == 0U)
+    {
+        return;
+    }
+    if ((Flags & DMA_FLAG_TE) != 0U)
+    {
+        Handle->Errors++;
+        DMA_StreamStop(Port->Dma, Port->Stream);
+    }
+    else if ((Flags & DMA_FLAG_TC) == 0U)
+    {
+        return;
+    }
+
+    Last = &Handle->Config.Slots[(uint16_t)(Handle->Tail + Handle->InFlight - 1U) & (Handle->Config.SlotCount - 1U)];
+    Handle->Tail = (uint16_t)(Handle->Tail + Handle->InFlight);
+    Handle->InFlight = 0U;
+
+    if (Last->EndOfChain != 0U)
+    {
+        Handle->Chains++;
+        if (Handle->Config.Done != 0)
+        {
+            Handle->Config.Done(Last->ChainContext);
+        }
+    }
+
+    State = CORE_EnterCritical();
+    if (Handle->Head == Handle->Tail)
+    {
+        Handle->Busy = 0U;
+        Idle = 1U;
+    }
+    CORE_ExitCritical(State);
+
+    if (Idle == 0U)
+    {
+        USARTTX_StartNext(Handle);
+    }
+}
+
+/**
+ * @brief Starts a transfer from the slot at Tail.
+ *
+ * Following slots of the same chain that continue it in memory are merged into the
+ * transfer, up to the NDTR limit. The transfer never goes past a chain end, so each
+ * chain completes on its own interrupt.
+ */
+static void USARTTX_StartNext(USARTTX_Handle_t* Handle)
+{
+    const USARTTX_PortDef_t* Port = &USARTTX_Ports[Handle->Config.Port];
+    uint16_t Mask = (uint16_t)(Handle->Config.SlotCount - 1U);
+    uint16_t Queued = (uint16_t)(Handle->Head - Handle->Tail);
+    const USARTTX_Slot_t* Slot = &Handle->Config.Slots[Handle->Tail & Mask];
+    const USARTTX_Slot_t* Next = 0;
+    uint32_t Address = Slot->Address;
+    uint32_t Length = Slot->Length;
+    uint16_t Covered = 1U;
+
+    while ((Slot->EndOfChain == 0U) && (Covered < Queued))
+    {
+        Next = &Handle->Config.Slots[(uint16_t)(Handle->Tail + Covered) & Mask];
+        if ((Next->Address != (Address + Length)) || ((Length + Next->Length) > USARTTX_MAX_TRANSFER))
+        {
+            break;
+        }
+        Length += Next->Length;
+        Slot = Next;
+        Covered++;
+    }
+
+    Handle->InFlight = Covered;
+    Handle->Transfers++;
+    DMA_StreamStart(Port->Dma, Port->Stream, Address, (uint16_t)Length);
+}
@@ -0,0 +1,70 @@
+/**
+ * @file VECTOR_Program.c
+ * @brief Program for the vector table generated from the handler bindings.
+ *
+ * This file expands the slot lists of VECTOR_Private.h into the handler declarations,
+ * the compile-time checks and the table itself. Each slot is initialised exactly once, in
+ * table order, with its VECTOR_BIND_ binding from VECTOR_Config.h or VECTOR_DefaultHandler().
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/VECTOR_Interface.h"
+#include "../Inc/VECTOR_Private.h"
+#include "../Inc/VECTOR_Config.h"
+#include "../Inc/NVIC_Interface.h"
+#include "../../../LIB/CORE_Intrinsics.h"
+
+extern uint32_t _estack;    /**< Initial stack pointer, from the linker script */
+void Reset_Handler(void);
+
+VECTOR_CORE_SLOTS(VECTOR_DECLARE, VECTOR_NO_DECLARE)
+VECTOR_IRQ_SLOTS(VECTOR_DECLARE, VECTOR_NO_DECLARE)
+
+/* Slot lists against the STM32F446xx vector table (RM0390, table 38) and IRQn_Type */
+enum
+{
+    VECTOR_CORE_FIRST = 1,
+    VECTOR_CORE_SLOTS(VECTOR_CORE_POSITION, VECTOR_CORE_RESERVED_POSITION)
+    VECTOR_CORE_END
+};
+enum
+{
+    VECTOR_IRQ_SLOTS(VECTOR_IRQ_POSITION, VECTOR_IRQ_RESERVED_POSITION)
+    VECTOR_LISTED_IRQS
+};
+_Static_assert((uint32_t)VECTOR_CORE_END == VECTOR_IRQ_BASE, "VECTOR_CORE_SLOTS must list slots 2 to 15");
+_Static_assert((VECTOR_CorePosition_NMI == VECTOR_NMI) && (VECTOR_CorePosition_HardFault == VECTOR_HARDFAULT) &&
+               (VECTOR_CorePosition_MemManage == VECTOR_MEMMANAGE) && (VECTOR_CorePosition_BusFault == VECTOR_BUSFAULT) &&
+               (VECTOR_CorePosition_UsageFault == VECTOR_USAGEFAULT) && (VECTOR_CorePosition_SVCall == VECTOR_SVCALL) &&
+               (VECTOR_CorePosition_DebugMon == VECTOR_DEBUGMON) && (VECTOR_CorePosition_PendSV == VECTOR_PENDSV) &&
+               (VECTOR_CorePosition_SysTick == VECTOR_SYSTICK),
+               "A core slot is out of place in VECTOR_CORE_SLOTS");
+VECTOR_CORE_SLOTS(VECTOR_NO_CHECK, VECTOR_CHECK_CORE_RESERVED)
+_Static_assert((uint32_t)VECTOR_LISTED_IRQS == VECTOR_RM_IRQ_SLOTS, "VECTOR_IRQ_SLOTS must list the 97 IRQ slots of RM0390");
+_Static_assert(NVIC_IRQ_COUNT == VECTOR_RM_IRQ_SLOTS, "IRQn_Type must end at IRQ slot 96 (FMPI2C1_error)");
+VECTOR_IRQ_SLOTS(VECTOR_CHECK_POSITION, VECTOR_CHECK_RESERVED)
+
+static volatile uint32_t VECTOR_Unhandled = 0U;    /**< Exception number taken by the default handler */
+
+__attribute__((section(".isr_vector"), used)) const VECTOR_Entry_t VECTOR_Table[VECTOR_SIZE] =
+{
+    { .Stack = &_estack },
+    { .Handler = Reset_Handler },
+    VECTOR_CORE_SLOTS(VECTOR_ENTRY, VECTOR_CORE_RESERVED_ENTRY)
+    VECTOR_IRQ_SLOTS(VECTOR_ENTRY, VECTOR_IRQ_RESERVED_ENTRY)
+};
+
+/**
+ * @brief Handler of every unbound slot.
+ */
+void VECTOR_DefaultHandler(void)
+{
+    VECTOR_Unhandled = CORE_GetIPSR();
+
+    for (;;)
+    {
+        /* Unbound exception: inspect VECTOR_Unhandled */
+    }
+}
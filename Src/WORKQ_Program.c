@@ -0,0 +1,89 @@
+/**
+ * @file WORKQ_Program.c
+ * @brief Program for the deduplicating work bitmap served by a software IRQ.
+ *
+ * This file posts with an LDREX/STREX fetch-or and drains with a swap to zero, so neither
+ * side masks interrupts; the items taken are then found with CLZ.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/WORKQ_Interface.h"
+#include "../Inc/NVIC_Interface.h"
+#include "../../../LIB/CORE_Intrinsics.h"
+#include "../../../LIB/ErrType.h"
+
+/**
+ * @brief Sets up a queue on its IRQ.
+ */
+uint8_t WORKQ_Init(WORKQ_Queue_t* Queue, const WORKQ_Work_t* Works, uint8_t ItemCount, void* Context, IRQn_Type IRQn,
+                   uint32_t Priority)
+{
+    uint8_t Item = 0U;
+
+    if ((Queue == 0) || (Works == 0))
+    {
+        return NULL_PTR_ERR;
+    }
+    if ((ItemCount == 0U) || (ItemCount > WORKQ_MAX_ITEMS))
+    {
+        return NOK;
+    }
+    for (Item = 0U; Item < ItemCount; Item++)
+    {
+        if (Works[Item] == 0)
+        {
+            return NULL_PTR_ERR;
+        }
+    }
+
+    Queue->Pending = 0U;
+    Queue->Works = Works;
+    Queue->Context = Context;
+    Queue->ItemCount = ItemCount;
+    Queue->IRQn = IRQn;
+
+    NVIC_SetPriority(IRQn, Priority);
+    NVIC_EnableIRQClean(IRQn);
+
+    return OK;
+}
+
+/**
+ * @brief Posts a work item.
+ *
+ * Only the post that makes the word non-zero pends the IRQ: while any bit is set, a run
+ * of the IRQ is already coming and will see the new bit.
+ */
+uint8_t WORKQ_Post(WORKQ_Queue_t* Queue, uint8_t Item)
+{
+    if (Item >= Queue->ItemCount)
+    {
+        return NOK;
+    }
+
+    if (CORE_AtomicFetchOr(&Queue->Pending, 1UL << Item) == 0U)
+    {
+        NVIC_SetPendingIRQ(Queue->IRQn);
+    }
+
+    return OK;
+}
+
+/**
+ * @brief Runs every posted item once.
+ */
+void WORKQ_Dispatch(void* Queue)
+{
+    WORKQ_Queue_t* WorkQueue = (WORKQ_Queue_t*)Queue;
+    uint32_t Items = CORE_AtomicSwap(&WorkQueue->Pending, 0U);
+    uint32_t Item = 0U;
+
+    while (Items != 0U)
+    {
+        Item = 31U - CORE_CLZ(Items);
+        Items &= ~(1UL << Item);
+        WorkQueue->Works[Item]((uint8_t)Item, WorkQueue->Context);
+    }
+}
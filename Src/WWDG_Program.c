@@ -0,0 +1,175 @@
+/**
+ * @file WWDG_Program.c
+ * @brief Program for the window watchdog driver with a pre-reset NVIC snapshot.
+ *
+ * This file provides the watchdog start/refresh functions and the early wakeup handler
+ * that saves the NVIC enable, pending and active words, plus the application load
+ * counters, into RAM the startup code does not clear.
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include "../Inc/WWDG_Interface.h"
+#include "../Inc/WWDG_Private.h"
+#include "../Inc/NVIC_Interface.h"
+#include "../../../LIB/STM32F446xx.h"
+#include "../../../LIB/CORE_Intrinsics.h"
+#include "../../../LIB/ErrType.h"
+
+static WWDG_Snapshot_t WWDG_Snapshot WWDG_RETAINED;   /**< Survives the watchdog reset */
+
+static uint8_t WWDG_Reload = WWDG_COUNTER_MASK;       /**< Counter value written by WWDG_Refresh() */
+static const volatile uint32_t* WWDG_LoadCounters = 0;
+static uint32_t WWDG_LoadCounterCount = 0U;
+
+static uint32_t WWDG_Checksum(const WWDG_Snapshot_t* Snapshot);
+
+/**
+ * @brief Starts the window watchdog with its early wakeup interrupt.
+ *
+ * @param[in] Config  Watchdog configuration.
+ * @return uint8_t OK on success, NULL_PTR_ERR or NOK on invalid arguments.
+ */
+uint8_t WWDG_Init(const WWDG_Config_t* Config)
+{
+    if (Config == 0)
+    {
+        return NULL_PTR_ERR;
+    }
+    if ((Config->Prescaler > 3U) || (Config->Counter <= WWDG_COUNTER_MIN) || (Config->Counter > WWDG_COUNTER_MASK) ||
+        (Config->Window < WWDG_COUNTER_MIN) || (Config->Window > WWDG_COUNTER_MASK))
+    {
+        return NOK;
+    }
+
+    /* The snapshot is timestamped with the DWT cycle counter */
+    COREDEBUG->DEMCR |= (1UL << COREDEBUG_DEMCR_TRCENA);
+    DWT->CTRL |= (1UL << DWT_CTRL_CYCCNTENA);
+
+    RCC_REG->APB1ENR |= (1UL << WWDG_RCC_APB1ENR_WWDGEN);
+
+    WWDG_Reload = Config->Counter;
+
+    NVIC_SetPriority(WWDG, WWDG_EARLY_PRIORITY);
+    WWDG_REG->SR = 0U;
+    NVIC_ClearPendingIRQ(WWDG);
+    NVIC_EnableIRQ(WWDG);
+
+    WWDG_REG->CFR = ((uint32_t)Config->Window & WWDG_COUNTER_MASK) | ((uint32_t)Config->Prescaler << WWDG_CFR_WDGTB) |
+                    (1UL << WWDG_CFR_EWI);
+    WWDG_REG->CR = (1UL << WWDG_CR_WDGA) | Config->Counter;
+
+    return OK;
+}
+
+/**
+ * @brief Reloads the watchdog counter; call it inside the configured window.
+ */
+void WWDG_Refresh(void)
+{
+    WWDG_REG->CR = (1UL << WWDG_CR_WDGA) | WWDG_Reload;
+}
+
+/**
+ * @brief Registers the per-IRQ load counters copied into the snapshot.
+ *
+ * The pointer and the count are updated with interrupts masked, so the early wakeup
+ * handler never sees a new pointer with an old count.
+ *
+ * @param[in] Counters  Array of counters maintained by the application, indexed by IRQn.
+ * @param[in] Count     Number of counters, at most WWDG_MAX_LOAD_COUNTERS.
+ */
+void WWDG_RegisterLoadCounters(const volatile uint32_t* Counters, uint32_t Count)
+{
+    uint32_t State = CORE_EnterCritical();
+
+    WWDG_LoadCounters = Counters;
+    WWDG_LoadCounterCount = (Counters == 0) ? 0U : ((Count > WWDG_MAX_LOAD_COUNTERS) ? WWDG_MAX_LOAD_COUNTERS : Count);
+    CORE_ExitCritical(State);
+}
+
+/**
+ * @brief Retrieves the snapshot left by the previous run.
+ *
+ * @param[out] Snapshot  Copy of the snapshot.
+ * @return uint8_t OK when the last reset came from the watchdog and the snapshot is intact, NOK otherwise.
+ */
+uint8_t WWDG_GetSnapshot(WWDG_Snapshot_t* Snapshot)
+{
+    if (Snapshot == 0)
+    {
+        return NULL_PTR_ERR;
+    }
+    if (((RCC_REG->CSR & (1UL << WWDG_RCC_CSR_WWDGRSTF)) == 0U) || (WWDG_Snapshot.Magic != WWDG_SNAPSHOT_MAGIC) ||
+        (WWDG_Snapshot.LoadCount > WWDG_MAX_LOAD_COUNTERS) || (WWDG_Snapshot.Checksum != WWDG_Checksum(&WWDG_Snapshot)))
+    {
+        return NOK;
+    }
+
+    *Snapshot = WWDG_Snapshot;
+
+    return OK;
+}
+
+/**
+ * @brief Invalidates the retained snapshot and clears the reset flags.
+ */
+void WWDG_ClearSnapshot(void)
+{
+    WWDG_Snapshot.Magic = 0U;
+    RCC_REG->CSR |= (1UL << WWDG_RCC_CSR_RMVF);
+}
+
+/**
+ * @brief Early wakeup interrupt handler, captures the snapshot before the reset.
+ *
+ * The counter has reached 0x40: the reset follows one counter tick later, so the
+ * handler only copies registers and does not refresh. The magic is written last so
+ * that a capture cut short by the reset is never mistaken for a valid one.
+ */
+void WWDG_IRQHandler(void)
+{
+    uint32_t Word = 0U;
+    uint32_t Count = WWDG_LoadCounterCount;
+
+    WWDG_REG->SR = 0U;
+
+    WWDG_Snapshot.Magic = 0U;
+    WWDG_Snapshot.Timestamp = DWT->CYCCNT;
+    for (Word = 0U; Word < NVIC_IRQ_WORDS; Word++)
+    {
+        WWDG_Snapshot.Enabled[Word] = NVIC->ISER[Word];
+        WWDG_Snapshot.Pending[Word] = NVIC->ISPR[Word];
+        WWDG_Snapshot.Active[Word] = NVIC->IABR[Word];
+    }
+
+    WWDG_Snapshot.LoadCount = Count;
+    for (Word = 0U; Word < Count; Word++)
+    {
+        WWDG_Snapshot.Load[Word] = WWDG_LoadCounters[Word];
+    }
+
+    WWDG_Snapshot.Checksum = WWDG_Checksum(&WWDG_Snapshot);
+    WWDG_Snapshot.Magic = WWDG_SNAPSHOT_MAGIC;
+}
+
+/**
+ * @brief Computes the checksum of a snapshot (rotate-and-xor over its words).
+ *
+ * The magic and checksum words are excluded, unused load counters are not covered.
+ */
+static uint32_t WWDG_Checksum(const WWDG_Snapshot_t* Snapshot)
+{
+    const uint32_t* Words = &Snapshot->Timestamp;
+    uint32_t WordCount = 1U + (3U * NVIC_IRQ_WORDS) + 1U + Snapshot->LoadCount;
+    uint32_t Sum = WWDG_SNAPSHOT_MAGIC;
+    uint32_t Index = 0U;
+
+    for (Index = 0U; Index < WordCount; Index++)
+    {
+        Sum = ((Sum << 5) | (Sum >> 27)) ^ Words[Index];
+    }
+
+    return Sum;
+}
@@ -0,0 +1,181 @@
+/**
+ * @file CANSIM_Scaling.c
+ * @brief Host scaling driver of the CAN fleet simulation.
+ *
+ * Runs the same fleet on 1, 2, 4 and 8 threads and prints, per thread count, the wall
+ * time, the speed-up over one thread and the fleet totals. Every node transmits one
+ * 8-byte frame whenever a mailbox is free, with its index as identifier, so the bus is
+ * saturated and the arbitration never sees a tie. Every RX0 handler drains FIFO 0.
+ * Checks:
+ *   - no frame is lost to a full FIFO 0: a frame takes the bus for over 100 us, far
+ *     longer than the handler that empties the FIFO
+ *   - the totals are the same at every thread count, the run being deterministic
+ * The speed-up depends on the cores of the host; it stays near 1 on a single core.
+ *
+ * Build (from the driver directory, with LIB three levels up as for the firmware):
+ *   cc -O2 -pthread -o CansimScaling Tests/CANSIM_Scaling.c Src/CANSIM_Program.c Src/NVIC_Model_Program.c
+ * Usage: CansimScaling [nodes] [ticks]      (default 300 nodes, 2000 ticks of 1 ms at 500 kbit/s;
+ *                                            exit status 0 when every check passed)
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "../Inc/CANSIM_Interface.h"
+#include "../../../LIB/ErrType.h"
+
+#define SCALING_DEFAULT_NODES    300UL
+#define SCALING_DEFAULT_TICKS    2000UL
+#define SCALING_BIT_RATE         500000U
+#define SCALING_TICK_US          1000U
+
+/**
+ * @struct Scaling_Totals_t
+ * @brief Counters summed over the fleet.
+ */
+typedef struct
+{
+    uint64_t FramesSent;
+    uint64_t FramesReceived;
+    uint64_t RxIrqs;
+    uint64_t TxIrqs;
+    uint64_t RxOverruns;
+    uint64_t ArbitrationLost;
+    uint32_t BusLoad;          /**< Per mille */
+} Scaling_Totals_t;
+
+/**
+ * @brief Thread-mode code: keeps a frame in a mailbox at all times.
+ */
+static void Scaling_Tick(CANSIM_Node_t* Node, uint32_t Tick)
+{
+    CANSIM_Frame_t Frame = { 0 };
+
+    Frame.Id = Node->Index;
+    Frame.Dlc = 8U;
+    memcpy(Frame.Data, &Tick, sizeof(Tick));
+    (void)CANSIM_Transmit(Node, &Frame);
+}
+
+/**
+ * @brief CAN1_RX0 handler: empties FIFO 0.
+ */
+static void Scaling_RxIrq(CANSIM_Node_t* Node)
+{
+    CANSIM_Frame_t Frame;
+
+    while (CANSIM_Receive(Node, &Frame) == OK)
+    {
+        /* Frames are only counted */
+    }
+}
+
+static const CANSIM_App_t Scaling_App = { Scaling_Tick, Scaling_RxIrq, 0 };
+
+/**
+ * @brief Runs the fleet on a number of threads; returns the wall time in seconds.
+ */
+static double Scaling_Run(uint32_t Nodes, uint32_t Ticks, uint32_t Threads, Scaling_Totals_t* Totals)
+{
+    CANSIM_Config_t Config = { Nodes, Threads, SCALING_BIT_RATE, SCALING_TICK_US, 3U, 4U, &Scaling_App };
+    CANSIM_Sim_t Sim;
+    const CANSIM_NodeStats_t* Stats = 0;
+    struct timespec Start;
+    struct timespec End;
+    uint32_t Index = 0U;
+
+    memset(Totals, 0, sizeof(*Totals));
+    if (CANSIM_Create(&Sim, &Config) != OK)
+    {
+        return -1.0;
+    }
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &Start);
+    if (CANSIM_Run(&Sim, Ticks) != OK)
+    {
+        CANSIM_Destroy(&Sim);
+        return -1.0;
+    }
+    (void)clock_gettime(CLOCK_MONOTONIC, &End);
+
+    for (Index = 0U; Index < Nodes; Index++)
+    {
+        Stats = &CANSIM_GetNode(&Sim, Index)->Stats;
+        Totals->FramesSent += Stats->FramesSent;
+        Totals->FramesReceived += Stats->FramesReceived;
+        Totals->RxIrqs += Stats->RxIrqs;
+        Totals->TxIrqs += Stats->TxIrqs;
+        Totals->RxOverruns += Stats->RxOverruns;
+        Totals->ArbitrationLost += Stats->ArbitrationLost;
+    }
+    Totals->BusLoad = CANSIM_GetBusLoad(&Sim);
+    CANSIM_Destroy(&Sim);
+
+    return (double)(End.tv_sec - Start.tv_sec) + ((double)(End.tv_nsec - Start.tv_nsec) / 1e9);
+}
+
+int main(int argc, char** argv)
+{
+    static const uint32_t ThreadCounts[] = { 1U, 2U, 4U, 8U };
+    uint32_t Nodes = (argc > 1) ? (uint32_t)strtoul(argv[1], 0, 10) : SCALING_DEFAULT_NODES;
+    uint32_t Ticks = (argc > 2) ? (uint32_t)strtoul(argv[2], 0, 10) : SCALING_DEFAULT_TICKS;
+    Scaling_Totals_t Reference = { 0 };
+    Scaling_Totals_t Totals = { 0 };
+    double Single = 0.0;
+    double Seconds = 0.0;
+    uint32_t Index = 0U;
+    uint8_t Pass = 1U;
+
+    printf("%u nodes, %u ticks of %u us at %u bit/s\n", (unsigned)Nodes, (unsigned)Ticks, SCALING_TICK_US,
+           SCALING_BIT_RATE);
+    printf("threads   seconds  speed-up    sent   received    RX IRQs   overruns  bus load\n");
+
+    for (Index = 0U; Index < (sizeof(ThreadCounts) / sizeof(ThreadCounts[0])); Index++)
+    {
+        if (ThreadCounts[Index] > Nodes)
+        {
+            break;
+        }
+
+        Seconds = Scaling_Run(Nodes, Ticks, ThreadCounts[Index], &Totals);
+        if (Seconds < 0.0)
+        {
+            printf("%7u   simulation could not start\n", (unsigned)ThreadCounts[Index]);
+            Pass = 0U;
+            continue;
+        }
+        if (Index == 0U)
+        {
+            Single = Seconds;
+            Reference = Totals;
+        }
+
+        printf("%7u  %8.3f  %8.2f  %6llu  %9llu  %9llu  %9llu  %4u.%u %%\n", (unsigned)ThreadCounts[Index], Seconds,
+               (Seconds > 0.0) ? (Single / Seconds) : 0.0, (unsigned long long)Totals.FramesSent,
+               (unsigned long long)Totals.FramesReceived, (unsigned long long)Totals.RxIrqs,
+               (unsigned long long)Totals.RxOverruns, (unsigned)(Totals.BusLoad / 10U),
+               (unsigned)(Totals.BusLoad % 10U));
+
+        if (Totals.RxOverruns != 0U)
+        {
+            printf("  %llu frames lost to a full FIFO 0\n", (unsigned long long)Totals.RxOverruns);
+            Pass = 0U;
+        }
+        if (memcmp(&Totals, &Reference, sizeof(Totals)) != 0)
+        {
+            printf("  totals differ from the single-thread run\n");
+            Pass = 0U;
+        }
+    }
+
+    printf("%s\n", (Pass != 0U) ? "PASS" : "FAIL");
+
+    return (Pass != 0U) ? 0 : 1;
+}
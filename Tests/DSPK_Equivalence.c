@@ -0,0 +1,391 @@
+/**
+ * @file DSPK_Equivalence.c
+ * @brief Host test checking the SIMD signal processing kernels against the reference ones.
+ *
+ * The kernels are built here with DSPK_SIMD forced to 1. Off the Cortex-M4, CORE_SMLALD()
+ * and CORE_QADD16() are emulated in plain C from their definitions in the Armv7-M
+ * reference manual. On a core with the DSP extension, the real instructions are used.
+ * Every kernel runs twice on the same random blocks, once per version. The outputs
+ * must match bit for bit. The runs cover:
+ *   - FIR tap counts from 1 to 33, so every remainder of the 4-tap SIMD loop
+ *   - odd block lengths, and decimation factors 1 to 4
+ *   - Out == In on the SIMD side (Out == A and Out == B for the add)
+ *   - full-scale samples and coefficients, so outputs saturate at 32767 and -32768
+ *   - biquad cascades of 1 to 3 stages with PostShift 0, 1 and 2
+ *
+ * Build (from the driver directory, with LIB three levels up as for the firmware):
+ *   cc -O2 -o DspkEquivalence Tests/DSPK_Equivalence.c
+ * Usage: DspkEquivalence [seed]        (exit status 0 when every check passed)
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define DSPK_SIMD                1
+
+#if !defined(__ARM_FEATURE_DSP) || (__ARM_FEATURE_DSP != 1)
+/**
+ * @brief SMLALD emulation: Acc + X[15:0] * Y[15:0] + X[31:16] * Y[31:16], signed, 64-bit.
+ */
+static inline int64_t CORE_SMLALD(uint32_t X, uint32_t Y, int64_t Acc)
+{
+    int32_t Low = (int32_t)(int16_t)(uint16_t)X * (int32_t)(int16_t)(uint16_t)Y;
+    int32_t High = (int32_t)(int16_t)(uint16_t)(X >> 16) * (int32_t)(int16_t)(uint16_t)(Y >> 16);
+
+    return Acc + (int64_t)Low + (int64_t)High;
+}
+
+/**
+ * @brief Signed saturation of a sum to 16 bits, as SignedSat(Sum, 16).
+ */
+static inline uint32_t Equiv_Sat16(int32_t Sum)
+{
+    if (Sum > 32767)
+    {
+        Sum = 32767;
+    }
+    else if (Sum < -32768)
+    {
+        Sum = -32768;
+    }
+    else
+    {
+        /* In range */
+    }
+
+    return (uint32_t)(uint16_t)(int16_t)Sum;
+}
+
+/**
+ * @brief QADD16 emulation: two saturating signed 16-bit additions.
+ */
+static inline uint32_t CORE_QADD16(uint32_t X, uint32_t Y)
+{
+    uint32_t Low = Equiv_Sat16((int32_t)(int16_t)(uint16_t)X + (int32_t)(int16_t)(uint16_t)Y);
+    uint32_t High = Equiv_Sat16((int32_t)(int16_t)(uint16_t)(X >> 16) + (int32_t)(int16_t)(uint16_t)(Y >> 16));
+
+    return Low | (High << 16);
+}
+#endif
+
+#include "../Src/DSPK_Program.c"
+
+#define EQUIV_BLOCK_MAX          60U      /**< A multiple of every decimation factor tried */
+#define EQUIV_MAX_TAPS           33U
+#define EQUIV_MAX_STAGES         3U
+#define EQUIV_BLOCKS             200U     /**< Blocks per configuration */
+
+/**
+ * @enum Equiv_Kind_t
+ * @brief Sample distributions.
+ */
+typedef enum
+{
+    EQUIV_RANDOM = 0U,    /**< Uniform over the whole Q15 range */
+    EQUIV_FULL_SCALE,     /**< Mostly 32767 and -32768, to drive the outputs into saturation */
+    EQUIV_KINDS
+} Equiv_Kind_t;
+
+/**
+ * @struct Equiv_Stats_t
+ * @brief Results of one kernel.
+ */
+typedef struct
+{
+    uint32_t Blocks;
+    uint32_t Samples;
+    uint32_t Mismatches;    /**< Output samples differing between the two versions */
+    uint32_t Saturated;     /**< Reference outputs equal to 32767 or -32768 */
+} Equiv_Stats_t;
+
+static uint32_t Equiv_Seed = 0x2545F491UL;
+
+/**
+ * @brief xorshift32 generator, for runs that repeat from a seed.
+ */
+static uint32_t Equiv_Random(void)
+{
+    Equiv_Seed ^= Equiv_Seed << 13;
+    Equiv_Seed ^= Equiv_Seed >> 17;
+    Equiv_Seed ^= Equiv_Seed << 5;
+
+    return Equiv_Seed;
+}
+
+/**
+ * @brief Returns a value in [0, Range).
+ */
+static uint32_t Equiv_Below(uint32_t Range)
+{
+    return Equiv_Random() % Range;
+}
+
+/**
+ * @brief Draws a sample.
+ */
+static int16_t Equiv_Sample(Equiv_Kind_t Kind)
+{
+    uint32_t Draw = Equiv_Random();
+
+    if ((Kind == EQUIV_FULL_SCALE) && ((Draw & 0x300U) != 0U))
+    {
+        return ((Draw & 1U) != 0U) ? INT16_MAX : INT16_MIN;
+    }
+
+    return (int16_t)(uint16_t)(Draw >> 16);
+}
+
+/**
+ * @brief Fills a buffer with samples.
+ */
+static void Equiv_Fill(int16_t* Samples, uint32_t Count, Equiv_Kind_t Kind)
+{
+    uint32_t Index = 0U;
+
+    for (Index = 0U; Index < Count; Index++)
+    {
+        Samples[Index] = Equiv_Sample(Kind);
+    }
+}
+
+/**
+ * @brief Compares the SIMD output with the reference output.
+ */
+static void Equiv_Compare(Equiv_Stats_t* Stats, const int16_t* Simd, const int16_t* Reference, uint32_t Count)
+{
+    uint32_t Index = 0U;
+
+    Stats->Blocks++;
+    Stats->Samples += Count;
+    for (Index = 0U; Index < Count; Index++)
+    {
+        if (Simd[Index] != Reference[Index])
+        {
+            Stats->Mismatches++;
+        }
+        if ((Reference[Index] == INT16_MAX) || (Reference[Index] == INT16_MIN))
+        {
+            Stats->Saturated++;
+        }
+    }
+}
+
+/**
+ * @brief FIR with every tap count up to EQUIV_MAX_TAPS and random, mostly odd, block lengths.
+ */
+static void Equiv_Fir(Equiv_Stats_t* Stats)
+{
+    static int16_t Coeffs[EQUIV_MAX_TAPS];
+    static int16_t SimdState[DSPK_FIR_STATE_SIZE(EQUIV_MAX_TAPS, EQUIV_BLOCK_MAX)];
+    static int16_t RefState[DSPK_FIR_STATE_SIZE(EQUIV_MAX_TAPS, EQUIV_BLOCK_MAX)];
+    int16_t In[EQUIV_BLOCK_MAX];
+    int16_t Simd[EQUIV_BLOCK_MAX];
+    int16_t Reference[EQUIV_BLOCK_MAX];
+    DSPK_FirQ15_t SimdFir;
+    DSPK_FirQ15_t RefFir;
+    uint32_t Taps = 0U;
+    uint32_t Kind = 0U;
+    uint32_t Block = 0U;
+    uint32_t Count = 0U;
+
+    for (Kind = 0U; Kind < EQUIV_KINDS; Kind++)
+    {
+        for (Taps = 1U; Taps <= EQUIV_MAX_TAPS; Taps++)
+        {
+            Equiv_Fill(Coeffs, Taps, (Equiv_Kind_t)Kind);
+            (void)DSPK_FirQ15Init(&SimdFir, Coeffs, (uint16_t)Taps, SimdState, EQUIV_BLOCK_MAX);
+            (void)DSPK_FirQ15Init(&RefFir, Coeffs, (uint16_t)Taps, RefState, EQUIV_BLOCK_MAX);
+
+            for (Block = 0U; Block < EQUIV_BLOCKS; Block++)
+            {
+                Count = 1U + Equiv_Below(EQUIV_BLOCK_MAX);
+                Equiv_Fill(In, Count, (Equiv_Kind_t)Kind);
+                (void)memcpy(Simd, In, Count * sizeof(int16_t));
+
+                DSPK_FirQ15(&SimdFir, Simd, Simd, Count);    /* Out == In */
+                DSPK_FirQ15Ref(&RefFir, In, Reference, Count);
+                Equiv_Compare(Stats, Simd, Reference, Count);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Decimating FIR with factors 1 to 4 and odd tap counts among the others.
+ */
+static void Equiv_Decim(Equiv_Stats_t* Stats)
+{
+    static int16_t Coeffs[EQUIV_MAX_TAPS];
+    static int16_t SimdState[DSPK_FIR_STATE_SIZE(EQUIV_MAX_TAPS, EQUIV_BLOCK_MAX)];
+    static int16_t RefState[DSPK_FIR_STATE_SIZE(EQUIV_MAX_TAPS, EQUIV_BLOCK_MAX)];
+    int16_t In[EQUIV_BLOCK_MAX];
+    int16_t Simd[EQUIV_BLOCK_MAX];
+    int16_t Reference[EQUIV_BLOCK_MAX];
+    DSPK_DecimQ15_t SimdDecim;
+    DSPK_DecimQ15_t RefDecim;
+    uint32_t Factor = 0U;
+    uint32_t Taps = 0U;
+    uint32_t Kind = 0U;
+    uint32_t Block = 0U;
+    uint32_t Count = 0U;
+
+    for (Kind = 0U; Kind < EQUIV_KINDS; Kind++)
+    {
+        for (Factor = 1U; Factor <= 4U; Factor++)
+        {
+            for (Taps = 1U; Taps <= EQUIV_MAX_TAPS; Taps += 4U)
+            {
+                Equiv_Fill(Coeffs, Taps, (Equiv_Kind_t)Kind);
+                (void)DSPK_DecimQ15Init(&SimdDecim, Coeffs, (uint16_t)Taps, SimdState, EQUIV_BLOCK_MAX, (uint8_t)Factor);
+                (void)DSPK_DecimQ15Init(&RefDecim, Coeffs, (uint16_t)Taps, RefState, EQUIV_BLOCK_MAX, (uint8_t)Factor);
+
+                for (Block = 0U; Block < EQUIV_BLOCKS; Block++)
+                {
+                    Count = Factor * (1U + Equiv_Below(EQUIV_BLOCK_MAX / Factor));
+                    Equiv_Fill(In, Count, (Equiv_Kind_t)Kind);
+                    (void)memcpy(Simd, In, Count * sizeof(int16_t));
+
+                    DSPK_DecimQ15(&SimdDecim, Simd, Simd, Count);    /* Out == In */
+                    DSPK_DecimQ15Ref(&RefDecim, In, Reference, Count);
+                    Equiv_Compare(Stats, Simd, Reference, Count / Factor);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Biquad cascades of 1 to EQUIV_MAX_STAGES stages with every PostShift.
+ */
+static void Equiv_Biquad(Equiv_Stats_t* Stats)
+{
+    int16_t Coeffs[DSPK_BIQUAD_COEFFS * EQUIV_MAX_STAGES];
+    int16_t SimdState[DSPK_BIQUAD_STATE_SIZE(EQUIV_MAX_STAGES)];
+    int16_t RefState[DSPK_BIQUAD_STATE_SIZE(EQUIV_MAX_STAGES)];
+    int16_t In[EQUIV_BLOCK_MAX];
+    int16_t Simd[EQUIV_BLOCK_MAX];
+    int16_t Reference[EQUIV_BLOCK_MAX];
+    DSPK_BiquadQ15_t SimdBiquad;
+    DSPK_BiquadQ15_t RefBiquad;
+    uint32_t PostShift = 0U;
+    uint32_t Stages = 0U;
+    uint32_t Kind = 0U;
+    uint32_t Block = 0U;
+    uint32_t Count = 0U;
+
+    for (Kind = 0U; Kind < EQUIV_KINDS; Kind++)
+    {
+        for (PostShift = 0U; PostShift <= DSPK_MAX_POSTSHIFT; PostShift++)
+        {
+            for (Stages = 1U; Stages <= EQUIV_MAX_STAGES; Stages++)
+            {
+                Equiv_Fill(Coeffs, DSPK_BIQUAD_COEFFS * Stages, (Equiv_Kind_t)Kind);
+                (void)DSPK_BiquadQ15Init(&SimdBiquad, Coeffs, (uint8_t)Stages, SimdState, (uint8_t)PostShift);
+                (void)DSPK_BiquadQ15Init(&RefBiquad, Coeffs, (uint8_t)Stages, RefState, (uint8_t)PostShift);
+
+                for (Block = 0U; Block < EQUIV_BLOCKS; Block++)
+                {
+                    Count = 1U + Equiv_Below(EQUIV_BLOCK_MAX);
+                    Equiv_Fill(In, Count, (Equiv_Kind_t)Kind);
+                    (void)memcpy(Simd, In, Count * sizeof(int16_t));
+
+                    DSPK_BiquadQ15(&SimdBiquad, Simd, Simd, Count);    /* Out == In */
+                    DSPK_BiquadQ15Ref(&RefBiquad, In, Reference, Count);
+                    Equiv_Compare(Stats, Simd, Reference, Count);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Saturating add with odd lengths, writing over either input.
+ */
+static void Equiv_Add(Equiv_Stats_t* Stats)
+{
+    int16_t A[EQUIV_BLOCK_MAX];
+    int16_t B[EQUIV_BLOCK_MAX];
+    int16_t Simd[EQUIV_BLOCK_MAX];
+    int16_t Reference[EQUIV_BLOCK_MAX];
+    uint32_t Kind = 0U;
+    uint32_t Block = 0U;
+    uint32_t Count = 0U;
+
+    for (Kind = 0U; Kind < EQUIV_KINDS; Kind++)
+    {
+        for (Block = 0U; Block < EQUIV_BLOCKS; Block++)
+        {
+            Count = 1U + Equiv_Below(EQUIV_BLOCK_MAX);
+            Equiv_Fill(A, Count, (Equiv_Kind_t)Kind);
+            Equiv_Fill(B, Count, (Equiv_Kind_t)Kind);
+            DSPK_AddQ15Ref(A, B, Reference, Count);
+
+            (void)memcpy(Simd, A, Count * sizeof(int16_t));
+            DSPK_AddQ15(Simd, B, Simd, Count);    /* Out == A */
+            Equiv_Compare(Stats, Simd, Reference, Count);
+
+            (void)memcpy(Simd, B, Count * sizeof(int16_t));
+            DSPK_AddQ15(A, Simd, Simd, Count);    /* Out == B */
+            Equiv_Compare(Stats, Simd, Reference, Count);
+        }
+    }
+}
+
+/**
+ * @brief Prints a kernel's results and reports whether they pass.
+ *
+ * A kernel passes with no mismatch and with some saturated outputs, so the limits were hit.
+ */
+static uint8_t Equiv_Check(const char* Name, const Equiv_Stats_t* Stats)
+{
+    uint8_t Pass = (uint8_t)((Stats->Mismatches == 0U) && (Stats->Saturated != 0U));
+
+    printf("  %-8s blocks %6lu  samples %8lu  saturated %7lu  mismatches %lu  %s\n", Name,
+           (unsigned long)Stats->Blocks, (unsigned long)Stats->Samples, (unsigned long)Stats->Saturated,
+           (unsigned long)Stats->Mismatches, (Pass != 0U) ? "ok" : "FAIL");
+
+    return Pass;
+}
+
+int main(int argc, char** argv)
+{
+    Equiv_Stats_t Fir = { 0 };
+    Equiv_Stats_t Decim = { 0 };
+    Equiv_Stats_t Biquad = { 0 };
+    Equiv_Stats_t Add = { 0 };
+    uint8_t Pass = 1U;
+
+    if (argc > 1)
+    {
+        Equiv_Seed = (uint32_t)strtoul(argv[1], 0, 0);
+        if (Equiv_Seed == 0U)
+        {
+            Equiv_Seed = 1U;    /* xorshift never leaves 0 */
+        }
+    }
+    printf("Seed 0x%08lX, %s\n", (unsigned long)Equiv_Seed,
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+           "DSP instructions");
+#else
+           "emulated DSP instructions");
+#endif
+
+    Equiv_Fir(&Fir);
+    Equiv_Decim(&Decim);
+    Equiv_Biquad(&Biquad);
+    Equiv_Add(&Add);
+
+    Pass = (uint8_t)(Equiv_Check("fir", &Fir) && Pass);
+    Pass = (uint8_t)(Equiv_Check("decim", &Decim) && Pass);
+    Pass = (uint8_t)(Equiv_Check("biquad", &Biquad) && Pass);
+    Pass = (uint8_t)(Equiv_Check("add", &Add) && Pass);
+
+    printf("%s\n", (Pass != 0U) ? "PASS" : "FAIL");
+
+    return (Pass != 0U) ? 0 : 1;
+}
@@ -0,0 +1,333 @@
+/**
+ * @file SEQLOCK_Torture.c
+ * @brief Host torture test of the SEQLOCK latch on the POSIX port of the NVIC driver.
+ *
+ * Readers run in interrupt handlers at several priority levels and check every value
+ * they read: all the words of a block must come from the same write. Two phases:
+ *   - Task writer: the writer runs in thread mode and the readers preempt it. Every
+ *     read must succeed at its first attempt (the sequence does not move during it).
+ *   - ISR writer: the writer runs at level 1 and preempts the readers at lower levels
+ *     and in thread mode. A read may then fail, but only after SEQLOCK_MAX_RETRIES
+ *     attempts all overlapped by writes, i.e. the sequence moved at least that often.
+ * A peripheral thread woken by a fast timer pends the handlers. Its wake-up preempts the
+ * CPU thread wherever it runs, even on a single core, so the interrupts land all over
+ * the writer and reader code; MidWrite counts the reads that found
+ * the writer between its two sequence increments. A phase ends when every reader has
+ * done the requested number of reads, or fails after TORTURE_TIME_LIMIT seconds.
+ *
+ * Build (from the driver directory, with LIB three levels up as for the firmware):
+ *   cc -O2 -pthread -o SeqlockTorture Tests/SEQLOCK_Torture.c Src/NVIC_Posix_Program.c Src/NVIC_Model_Program.c
+ * Usage: SeqlockTorture [reads]        (per reader and phase; exit status 0 when every check passed)
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+#include "../Inc/NVIC_Interface.h"
+#include "../Inc/NVIC_Posix_Interface.h"
+#include "../Inc/SEQLOCK_Interface.h"
+
+#define TORTURE_WORDS          64U        /**< Block size: long copies widen the race windows */
+#define TORTURE_DEFAULT_READS  20000UL
+#define TORTURE_TIME_LIMIT     60         /**< Seconds per phase */
+#define TORTURE_TICK_NS        20000L     /**< Period of the peripheral's timer */
+#define TORTURE_PENDS_PER_TICK 4U
+#define TORTURE_READERS        3U
+
+/**
+ * @brief Block written as a whole: word n of a block written with Stamp is Stamp ^ Salt(n).
+ */
+typedef struct
+{
+    uint32_t Words[TORTURE_WORDS];
+} Torture_Block_t;
+
+SEQLOCK_DEFINE(Torture_Lock, Torture_Block_t)
+
+/**
+ * @brief Statistics of one reader context.
+ */
+typedef struct
+{
+    volatile uint32_t Reads;
+    volatile uint32_t Failed;       /**< NOK results, allowed in the ISR writer phase only */
+    volatile uint32_t Torn;         /**< OK results holding words of different writes */
+    volatile uint32_t Retried;      /**< OK results whose read overlapped a write */
+    volatile uint32_t EarlyGiveUp;  /**< NOK results with fewer than SEQLOCK_MAX_RETRIES writes */
+    volatile uint32_t MidWrite;     /**< Reads started while copy 0 was being written */
+} Torture_Stats_t;
+
+static Torture_Lock_t Torture_Lock;
+static const IRQn_Type Torture_ReaderIrq[TORTURE_READERS] = { TIM2, TIM3, TIM4 };
+static const uint32_t Torture_ReaderLevel[TORTURE_READERS] = { 3U, 7U, 11U };
+static Torture_Stats_t Torture_ReaderStats[TORTURE_READERS];
+static Torture_Stats_t Torture_TaskStats;
+static volatile uint32_t Torture_Stamp = 0U;
+static volatile uint8_t Torture_IsrWriter = 0U;    /**< Phase: the writer is the TIM5 handler */
+static volatile uint8_t Torture_Stop = 0U;
+
+/**
+ * @brief Salt of word n, so that a block of zeros or a shifted copy never looks valid.
+ */
+static uint32_t Torture_Salt(uint32_t Word)
+{
+    return (Word + 1U) * 0x9E3779B1UL;
+}
+
+/**
+ * @brief Writes the next block.
+ */
+static void Torture_Write(void)
+{
+    Torture_Block_t Block;
+    uint32_t Stamp = Torture_Stamp + 1U;
+    uint32_t Word = 0U;
+
+    for (Word = 0U; Word < TORTURE_WORDS; Word++)
+    {
+        Block.Words[Word] = Stamp ^ Torture_Salt(Word);
+    }
+    Torture_Lock_Write(&Torture_Lock, &Block);
+    Torture_Stamp = Stamp;
+}
+
+/**
+ * @brief Reads a block and checks it.
+ */
+static void Torture_Read(Torture_Stats_t* Stats)
+{
+    Torture_Block_t Block;
+    uint32_t Before = Torture_Lock.Sequence;
+    uint8_t Status = Torture_Lock_Read(&Torture_Lock, &Block);
+    uint32_t Moved = Torture_Lock.Sequence - Before;
+    uint32_t Stamp = Block.Words[0] ^ Torture_Salt(0U);
+    uint32_t Word = 0U;
+
+    Stats->Reads++;
+    if ((Before & 1U) != 0U)
+    {
+        Stats->MidWrite++;
+    }
+    if (Status != OK)
+    {
+        Stats->Failed++;
+        if (Moved < SEQLOCK_MAX_RETRIES)
+        {
+            Stats->EarlyGiveUp++;
+        }
+        return;
+    }
+
+    if (Moved != 0U)
+    {
+        Stats->Retried++;
+    }
+    for (Word = 1U; Word < TORTURE_WORDS; Word++)
+    {
+        if (Block.Words[Word] != (Stamp ^ Torture_Salt(Word)))
+        {
+            Stats->Torn++;
+            break;
+        }
+    }
+}
+
+static void Torture_Reader0(void) { Torture_Read(&Torture_ReaderStats[0]); }
+static void Torture_Reader1(void) { Torture_Read(&Torture_ReaderStats[1]); }
+static void Torture_Reader2(void) { Torture_Read(&Torture_ReaderStats[2]); }
+
+/**
+ * @brief Level 1 writer of the ISR writer phase.
+ */
+static void Torture_WriterIsr(void)
+{
+    Torture_Write();
+}
+
+/**
+ * @brief Simulated peripheral: on each timer tick, pends readers, and the ISR writer in its phase.
+ */
+static void* Torture_Peripheral(void* Argument)
+{
+    struct sigevent Event = { 0 };
+    struct itimerspec Period = { { 0, TORTURE_TICK_NS }, { 0, TORTURE_TICK_NS } };
+    timer_t Timer;
+    sigset_t Tick;
+    int Signal = 0;
+    uint32_t Round = 0U;
+    uint32_t Pend = 0U;
+
+    (void)Argument;
+    (void)sigemptyset(&Tick);
+    (void)sigaddset(&Tick, SIGALRM);
+    Event.sigev_notify = SIGEV_SIGNAL;
+    Event.sigev_signo = SIGALRM;
+    if (timer_create(CLOCK_MONOTONIC, &Event, &Timer) != 0)
+    {
+        return 0;
+    }
+    (void)timer_settime(Timer, 0, &Period, 0);
+
+    while (Torture_Stop == 0U)
+    {
+        (void)sigwait(&Tick, &Signal);
+        for (Pend = 0U; Pend < TORTURE_PENDS_PER_TICK; Pend++)
+        {
+            NVIC_SetPendingIRQ(Torture_ReaderIrq[Round % TORTURE_READERS]);
+            if (Torture_IsrWriter != 0U)
+            {
+                NVIC_SetPendingIRQ(TIM5);
+            }
+            Round++;
+        }
+    }
+    (void)timer_delete(Timer);
+
+    return 0;
+}
+
+/**
+ * @brief Prints a context's statistics and reports whether they pass the phase's checks.
+ */
+static uint8_t Torture_Check(const char* Name, const Torture_Stats_t* Stats, uint8_t FailuresAllowed)
+{
+    uint8_t Pass = (uint8_t)((Stats->Torn == 0U) && (Stats->EarlyGiveUp == 0U));
+
+    if (FailuresAllowed == 0U)
+    {
+        Pass = (uint8_t)(Pass && (Stats->Failed == 0U) && (Stats->Retried == 0U));
+    }
+    printf("  %-8s reads %9lu  mid-write %7lu  retried %7lu  failed %5lu  torn %lu  early %lu  %s\n", Name,
+           (unsigned long)Stats->Reads, (unsigned long)Stats->MidWrite, (unsigned long)Stats->Retried,
+           (unsigned long)Stats->Failed, (unsigned long)Stats->Torn, (unsigned long)Stats->EarlyGiveUp,
+           (Pass != 0U) ? "ok" : "FAIL");
+
+    return Pass;
+}
+
+/**
+ * @brief Reports whether every reader has done Reads reads.
+ */
+static uint8_t Torture_Done(unsigned long Reads)
+{
+    uint32_t Reader = 0U;
+
+    for (Reader = 0U; Reader < TORTURE_READERS; Reader++)
+    {
+        if (Torture_ReaderStats[Reader].Reads < Reads)
+        {
+            return 0U;
+        }
+    }
+
+    return 1U;
+}
+
+/**
+ * @brief Runs one phase with the peripheral thread pending interrupts throughout.
+ */
+static uint8_t Torture_Phase(uint8_t IsrWriter, unsigned long Reads)
+{
+    static const char* const Names[TORTURE_READERS] = { "level 3", "level 7", "level 11" };
+    pthread_t Peripheral;
+    time_t Deadline = time(0) + TORTURE_TIME_LIMIT;
+    uint32_t MidWrite = 0U;
+    uint32_t Reader = 0U;
+    uint8_t Pass = 1U;
+
+    for (Reader = 0U; Reader < TORTURE_READERS; Reader++)
+    {
+        Torture_ReaderStats[Reader] = (Torture_Stats_t){ 0 };
+    }
+    Torture_TaskStats = (Torture_Stats_t){ 0 };
+    Torture_Stamp = 0U;
+    Torture_Write();
+    Torture_IsrWriter = IsrWriter;
+    Torture_Stop = 0U;
+
+    if (pthread_create(&Peripheral, 0, Torture_Peripheral, 0) != 0)
+    {
+        return 0U;
+    }
+    while ((Torture_Done(Reads) == 0U) && (time(0) < Deadline))
+    {
+        if (IsrWriter == 0U)
+        {
+            Torture_Write();
+        }
+        else
+        {
+            Torture_Read(&Torture_TaskStats);
+        }
+    }
+    Torture_Stop = 1U;
+    (void)pthread_join(Peripheral, 0);
+
+    printf("%s writer, %lu writes\n", (IsrWriter == 0U) ? "Task" : "ISR", (unsigned long)Torture_Stamp);
+    for (Reader = 0U; Reader < TORTURE_READERS; Reader++)
+    {
+        Pass = (uint8_t)(Torture_Check(Names[Reader], &Torture_ReaderStats[Reader], IsrWriter) && Pass);
+        MidWrite += Torture_ReaderStats[Reader].MidWrite;
+    }
+    if ((IsrWriter == 0U) && (MidWrite == 0U))
+    {
+        printf("  no read preempted the writer\n");
+        Pass = 0U;
+    }
+    if (IsrWriter != 0U)
+    {
+        Pass = (uint8_t)(Torture_Check("task", &Torture_TaskStats, 1U) && Pass);
+    }
+    if (Torture_Done(Reads) == 0U)
+    {
+        printf("  time limit reached\n");
+        Pass = 0U;
+    }
+
+    return Pass;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned long Reads = (argc > 1) ? strtoul(argv[1], 0, 0) : TORTURE_DEFAULT_READS;
+    uint32_t Reader = 0U;
+    uint8_t Pass = 1U;
+    sigset_t Tick;
+
+    (void)sigemptyset(&Tick);
+    (void)sigaddset(&Tick, SIGALRM);
+    (void)pthread_sigmask(SIG_BLOCK, &Tick, 0);   /**< Taken by the peripheral thread only, inherited */
+    if (NVIC_Posix_Init() != OK)
+    {
+        fprintf(stderr, "No real-time signals\n");
+        return 1;
+    }
+    for (Reader = 0U; Reader < TORTURE_READERS; Reader++)
+    {
+        NVIC_SetPriority(Torture_ReaderIrq[Reader], Torture_ReaderLevel[Reader]);
+        NVIC_EnableIRQ(Torture_ReaderIrq[Reader]);
+    }
+    NVIC_Posix_SetHandler(TIM2, Torture_Reader0);
+    NVIC_Posix_SetHandler(TIM3, Torture_Reader1);
+    NVIC_Posix_SetHandler(TIM4, Torture_Reader2);
+    NVIC_Posix_SetHandler(TIM5, Torture_WriterIsr);
+    NVIC_SetPriority(TIM5, 1U);
+    NVIC_EnableIRQ(TIM5);
+
+    Torture_Lock_Init(&Torture_Lock, &(Torture_Block_t){ { 0 } });   /**< Rewritten before any reader runs */
+
+    Pass = Torture_Phase(0U, Reads);
+    Pass = (uint8_t)(Torture_Phase(1U, Reads) && Pass);
+
+    printf("%s\n", (Pass != 0U) ? "PASS" : "FAIL");
+
+    return (Pass != 0U) ? 0 : 1;
+}
@@ -0,0 +1,207 @@
+/**
+ * @file TRACEENC_Order.c
+ * @brief Host test of the trace encoder and decoder clocks on out-of-order records.
+ *
+ * The encoder of TRACEENC_Program.c reads a trace ring filled here by hand. Its bytes
+ * go straight into the decoder of Tools/TraceDecode.c, and the decoded time of every
+ * record is checked. The sequences cover:
+ *   - records in order, to a precision of one timestamp unit
+ *   - a nested record stamped before the record ahead of it in the ring: it must decode
+ *     at the current clock, and the records after it at their own timestamps, with no
+ *     2^32 cycle jump
+ *   - timestamps crossing the CYCCNT wrap, which must still move forward
+ * Each sequence runs with timestamp units of 1 and 16 cycles.
+ *
+ * Build (from the driver directory, with LIB three levels up as for the firmware):
+ *   cc -O2 -o TraceencOrder Tests/TRACEENC_Order.c
+ * Usage: TraceencOrder        (exit status 0 when every check passed)
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+
+/* Host stand-ins: the encoder only needs the critical section and a readable CYCCNT */
+#define CORE_INTRINSICS_H
+static inline uint32_t CORE_EnterCritical(void) { return 0U; }
+static inline void CORE_ExitCritical(uint32_t State) { (void)State; }
+
+#include "../../../LIB/STM32F446xx.h"
+static DWT_RegDef_t Order_Dwt;
+#undef DWT
+#define DWT (&Order_Dwt)
+
+#include "../Src/TRACEENC_Program.c"
+
+/* The decoder, without its printing and with its main() out of the way */
+#define printf(...) ((void)0)
+#define main TraceDecode_Main
+#include "../Tools/TraceDecode.c"
+#undef main
+#undef printf
+
+#define ORDER_MAX_RECORDS    8U
+
+/**
+ * @struct Order_Event_t
+ * @brief One record of a sequence and the time it must decode at.
+ */
+typedef struct
+{
+    uint32_t Timestamp;
+    uint8_t IRQn;
+    uint8_t Event;           /**< TRACE_Event_t */
+    uint32_t Expected;       /**< Decoded time, before rounding down to the unit */
+} Order_Event_t;
+
+/**
+ * @struct Order_Sequence_t
+ * @brief A named list of records.
+ */
+typedef struct
+{
+    const char* Name;
+    uint32_t Count;
+    Order_Event_t Events[ORDER_MAX_RECORDS];
+} Order_Sequence_t;
+
+static const Order_Sequence_t Order_Sequences[] =
+{
+    { "in order", 4U, {
+        { 1000U, 7U, TRACE_ISR_ENTER, 1000U },
+        { 1100U, 7U, TRACE_ISR_EXIT,  1100U },
+        { 5000U, 9U, TRACE_ISR_ENTER, 5000U },
+        { 9000U, 9U, TRACE_ISR_EXIT,  9000U } } },
+    { "nested record stamped first", 6U, {
+        { 2000U, 3U, TRACE_ISR_ENTER, 2000U },
+        { 2100U, 5U, TRACE_ISR_ENTER, 2100U },
+        { 2090U, 6U, TRACE_ISR_ENTER, 2100U },   /* Stamped before the record ahead of it */
+        { 2300U, 6U, TRACE_ISR_EXIT,  2300U },
+        { 2400U, 5U, TRACE_ISR_EXIT,  2400U },
+        { 2500U, 3U, TRACE_ISR_EXIT,  2500U } } },
+    { "across the CYCCNT wrap", 4U, {
+        { 0xFFFFFF00UL, 4U, TRACE_ISR_ENTER, 0xFFFFFF00UL },
+        { 0xFFFFFFF0UL, 4U, TRACE_ISR_EXIT,  0xFFFFFFF0UL },
+        { 0x00000010UL, 4U, TRACE_ISR_ENTER, 0x00000010UL },
+        { 0x00000200UL, 4U, TRACE_ISR_EXIT,  0x00000200UL } } },
+};
+
+static TRACE_Buffer_t Order_Buffer;
+
+/**
+ * @brief Trace buffer read by the encoder, normally provided by TRACE_Program.c.
+ */
+const TRACE_Buffer_t* TRACE_GetBuffer(void)
+{
+    return &Order_Buffer;
+}
+
+/**
+ * @brief Appends one record to the ring.
+ */
+static void Order_Append(const Order_Event_t* Event)
+{
+    TRACE_Record_t* Record = &Order_Buffer.Records[Order_Buffer.Head & (TRACE_RECORD_COUNT - 1U)];
+
+    Record->Timestamp = Event->Timestamp;
+    Record->IRQn = Event->IRQn;
+    Record->Event = Event->Event;
+    Record->Depth = 0U;
+    Record->Reserved = 0U;
+    Order_Buffer.Head++;
+}
+
+/**
+ * @brief Encodes what the ring holds and feeds it to the decoder.
+ */
+static void Order_Drain(TraceDecode_t* Decoder)
+{
+    uint8_t Bytes[64];
+    uint32_t Length = 0U;
+    uint32_t Index = 0U;
+
+    while ((Length = TRACEENC_Encode(Bytes, sizeof(Bytes), 0xFFFFFFFFUL)) != 0U)
+    {
+        for (Index = 0U; Index < Length; Index++)
+        {
+            TraceDecode_Byte(Decoder, Bytes[Index]);
+        }
+    }
+}
+
+/**
+ * @brief Runs one sequence at one timestamp unit; reports whether every record decoded right.
+ *
+ * The decoded time is kept on 64 bits, so the expected times are extended the same way.
+ */
+static uint8_t Order_Run(const Order_Sequence_t* Sequence, uint8_t Shift)
+{
+    static TraceDecode_t Decoder;
+    uint64_t Base = 0U;
+    uint64_t Expected = 0U;
+    uint64_t Previous = 0U;
+    uint32_t Index = 0U;
+    uint8_t Pass = 1U;
+
+    Decoder = (TraceDecode_t){ 0 };
+    Decoder.LastEnter = TRACEDECODE_NO_IRQ;
+    Order_Buffer.Head = 0U;
+    (void)TRACEENC_Init(Shift);
+
+    for (Index = 0U; Index < Sequence->Count; Index++)
+    {
+        Order_Append(&Sequence->Events[Index]);
+        Order_Drain(&Decoder);
+
+        if (Index == 0U)
+        {
+            /* The SYNC and the first record: the decoder clock starts at the first timestamp */
+            Base = 0U;
+        }
+        else if (Sequence->Events[Index].Expected < Sequence->Events[Index - 1U].Expected)
+        {
+            Base += 0x100000000ULL;
+        }
+        Expected = Base + Sequence->Events[Index].Expected;
+
+        if ((Decoder.Records != (Index + 1U)) || (Decoder.Clock > Expected) ||
+            ((Expected - Decoder.Clock) >= (1ULL << Shift)) || (Decoder.Clock < Previous))
+        {
+            printf("  %-28s unit %2u  record %u: decoded %llu, expected %llu\n", Sequence->Name, 1U << Shift,
+                   (unsigned)Index, (unsigned long long)Decoder.Clock, (unsigned long long)Expected);
+            Pass = 0U;
+        }
+        Previous = Decoder.Clock;
+    }
+    if (Decoder.Errors != 0U)
+    {
+        printf("  %-28s unit %2u  %llu decoder errors\n", Sequence->Name, 1U << Shift,
+               (unsigned long long)Decoder.Errors);
+        Pass = 0U;
+    }
+    printf("  %-28s unit %2u  %s\n", Sequence->Name, 1U << Shift, (Pass != 0U) ? "ok" : "FAIL");
+
+    return Pass;
+}
+
+int main(void)
+{
+    static const uint8_t Shifts[] = { 0U, 4U };
+    uint32_t Sequence = 0U;
+    uint32_t Shift = 0U;
+    uint8_t Pass = 1U;
+
+    for (Sequence = 0U; Sequence < (sizeof(Order_Sequences) / sizeof(Order_Sequences[0])); Sequence++)
+    {
+        for (Shift = 0U; Shift < sizeof(Shifts); Shift++)
+        {
+            Pass = (uint8_t)(Order_Run(&Order_Sequences[Sequence], Shifts[Shift]) && Pass);
+        }
+    }
+
+    printf("%s\n", (Pass != 0U) ? "PASS" : "FAIL");
+
+    return (Pass != 0U) ? 0 : 1;
+}
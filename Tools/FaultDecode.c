@@ -0,0 +1,132 @@
+/**
+ * @file FaultDecode.c
+ * @brief Host decoder for the crash record saved by FAULT_Program.c.
+ *
+ * Reads the raw FAULT_Record_t image (as dumped from RAM by a debugger or sent over a
+ * serial link) from a file or standard input and prints the faulting context, the fault
+ * status bits and the interrupts that were active or pending.
+ *
+ * Build: cc -o FaultDecode Tools/FaultDecode.c
+ * Usage: FaultDecode [record.bin]
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include "../Inc/FAULT_Interface.h"
+
+/**
+ * @brief Names of the CFSR bits, index = bit position.
+ */
+static const char* const FaultDecode_CfsrNames[32] =
+{
+    "IACCVIOL", "DACCVIOL", 0, "MUNSTKERR", "MSTKERR", "MLSPERR", 0, "MMARVALID",
+    "IBUSERR", "PRECISERR", "IMPRECISERR", "UNSTKERR", "STKERR", "LSPERR", 0, "BFARVALID",
+    "UNDEFINSTR", "INVSTATE", "INVPC", "NOCP", 0, 0, 0, 0,
+    "UNALIGNED", "DIVBYZERO", 0, 0, 0, 0, 0, 0
+};
+
+static const char* const FaultDecode_ExceptionNames[7] =
+{
+    "Thread", "Reset", "NMI", "HardFault", "MemManage", "BusFault", "UsageFault"
+};
+
+static void FaultDecode_PrintIrqList(const char* Label, const uint32_t* Words)
+{
+    uint32_t IRQn = 0U;
+
+    printf("%-10s:", Label);
+    for (IRQn = 0U; IRQn < NVIC_IRQ_COUNT; IRQn++)
+    {
+        if ((Words[IRQn / 32U] & (1UL << (IRQn % 32U))) != 0U)
+        {
+            printf(" %u", (unsigned)IRQn);
+        }
+    }
+    printf("\n");
+}
+
+int main(int argc, char** argv)
+{
+    static const char* const FrameNames[FAULT_FRAME_WORDS] = { "R0", "R1", "R2", "R3", "R12", "LR", "PC", "xPSR" };
+    FAULT_Record_t Record;
+    const uint32_t* Words = (const uint32_t*)&Record;
+    FILE* Input = stdin;
+    uint32_t Sum = 0U;
+    uint32_t Index = 0U;
+    uint32_t ActiveIrq = 0U;
+
+    if ((argc > 1) && ((Input = fopen(argv[1], "rb")) == 0))
+    {
+        perror(argv[1]);
+        return 1;
+    }
+    if (fread(&Record, sizeof(Record), 1U, Input) != 1U)
+    {
+        fprintf(stderr, "record too short, expected %u bytes\n", (unsigned)sizeof(Record));
+        return 1;
+    }
+
+    for (Index = 0U; Index < ((sizeof(Record) / 4U) - 1U); Index++)
+    {
+        Sum += Words[Index];
+    }
+    if ((Record.Magic != FAULT_RECORD_MAGIC) || (Sum != Record.Checksum))
+    {
+        fprintf(stderr, "not a valid fault record (magic %08X, checksum %s)\n", (unsigned)Record.Magic,
+                (Sum == Record.Checksum) ? "ok" : "bad");
+        return 1;
+    }
+
+    printf("Exception : %u (%s)\n", (unsigned)Record.Exception,
+           (Record.Exception < 7U) ? FaultDecode_ExceptionNames[Record.Exception] : "IRQ");
+    printf("Context   : %s mode on %s, frame at %08X\n", ((Record.ExcReturn & 8U) != 0U) ? "thread" : "handler",
+           ((Record.ExcReturn & 4U) != 0U) ? "PSP" : "MSP", (unsigned)Record.StackPointer);
+
+    if (Record.FrameValid != 0U)
+    {
+        for (Index = 0U; Index < FAULT_FRAME_WORDS; Index++)
+        {
+            printf("%-10s: %08X\n", FrameNames[Index], (unsigned)Record.Frame[Index]);
+        }
+        /* The stacked xPSR holds the exception number of the faulting context */
+        ActiveIrq = Record.Frame[FAULT_FRAME_XPSR] & 0x1FFU;
+        if (ActiveIrq >= 16U)
+        {
+            printf("Faulted in: IRQ %u handler\n", (unsigned)(ActiveIrq - 16U));
+        }
+    }
+    else
+    {
+        printf("Frame     : not captured, stack pointer outside SRAM\n");
+    }
+
+    printf("CFSR      : %08X", (unsigned)Record.Cfsr);
+    for (Index = 0U; Index < 32U; Index++)
+    {
+        if (((Record.Cfsr & (1UL << Index)) != 0U) && (FaultDecode_CfsrNames[Index] != 0))
+        {
+            printf(" %s", FaultDecode_CfsrNames[Index]);
+        }
+    }
+    printf("\n");
+    printf("HFSR      : %08X%s%s\n", (unsigned)Record.Hfsr, ((Record.Hfsr & (1UL << 30)) != 0U) ? " FORCED" : "",
+           ((Record.Hfsr & (1UL << 1)) != 0U) ? " VECTTBL" : "");
+    if ((Record.Cfsr & (1UL << 7)) != 0U)
+    {
+        printf("MMFAR     : %08X\n", (unsigned)Record.Mmfar);
+    }
+    if ((Record.Cfsr & (1UL << 15)) != 0U)
+    {
+        printf("BFAR      : %08X\n", (unsigned)Record.Bfar);
+    }
+    printf("SHCSR     : %08X\n", (unsigned)Record.Shcsr);
+    printf("BASEPRI   : %u\n", (unsigned)(Record.BasePri >> 4));
+
+    FaultDecode_PrintIrqList("Active", Record.Active);
+    FaultDecode_PrintIrqList("Pending", Record.Pending);
+
+    return 0;
+}
@@ -0,0 +1,269 @@
+/**
+ * @file TraceDecode.c
+ * @brief Streaming host decoder for the trace stream written by TRACEENC_Program.c.
+ *
+ * Reads the byte stream (a capture file, or a serial port piped to standard input) in
+ * chunks and decodes it byte by byte, so a live stream is printed as it arrives. Each
+ * record is printed as its time in cycles, the event, the IRQ number and the nesting depth.
+ * A summary with the compression against raw 8-byte records is printed at the end.
+ *
+ * Build: cc -o TraceDecode Tools/TraceDecode.c
+ * Usage: TraceDecode [capture.bin]      (e.g. TraceDecode < /dev/ttyUSB0)
+ *
+ * @author Ahmed Atef
+ * @date 2026-10-18
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include "../Inc/TRACEENC_Interface.h"
+
+#define TRACEDECODE_NO_IRQ    0xFFU
+
+/**
+ * @brief Position of the decoder inside the current token.
+ */
+typedef enum
+{
+    TRACEDECODE_TOKEN = 0,     /**< Expecting a token byte */
+    TRACEDECODE_VARINT,        /**< Inside the escape varint */
+    TRACEDECODE_IRQ,           /**< Expecting the IRQ byte */
+    TRACEDECODE_SYNC,          /**< Inside the SYNC payload */
+    TRACEDECODE_OVERRUN        /**< Inside the OVERRUN count */
+} TraceDecode_Step_t;
+
+/**
+ * @brief Decoder state, mirroring TRACEENC_State_t, plus the partial token.
+ */
+typedef struct
+{
+    TraceDecode_Step_t Step;
+    uint8_t  Synced;            /**< A SYNC has been seen */
+    uint8_t  Flags;             /**< Flags of the current token */
+    uint32_t Delta;             /**< Delta of the current token */
+    uint32_t Value;             /**< Varint or payload being assembled */
+    uint32_t Bits;              /**< Varint bits or payload bytes gathered */
+    uint8_t  Shift;
+    uint64_t Clock;             /**< Extended 64-bit cycle count */
+    uint8_t  Depth;
+    uint8_t  LastEnter;
+    uint8_t  Stack[TRACEENC_MAX_DEPTH];
+    uint64_t Records;
+    uint64_t Lost;
+    uint64_t Bytes;
+    uint64_t Errors;
+} TraceDecode_t;
+
+/**
+ * @brief Completes a record: resolves the IRQ, updates the nesting state and prints it.
+ */
+static void TraceDecode_Record(TraceDecode_t* Decoder, uint8_t IRQn)
+{
+    uint8_t Exit = (uint8_t)((Decoder->Flags & TRACEENC_FLAG_EXIT) != 0U);
+
+    Decoder->Clock += (uint64_t)Decoder->Delta << Decoder->Shift;
+
+    if (Exit == 0U)
+    {
+        Decoder->LastEnter = IRQn;
+        if (Decoder->Depth < TRACEENC_MAX_DEPTH)
+        {
+            Decoder->Stack[Decoder->Depth] = IRQn;
+            Decoder->Depth++;
+        }
+        printf("%12llu ENTER IRQ %2u depth %u\n", (unsigned long long)Decoder->Clock, (unsigned)IRQn,
+               (unsigned)Decoder->Depth);
+    }
+    else
+    {
+        printf("%12llu EXIT  IRQ %2u depth %u\n", (unsigned long long)Decoder->Clock, (unsigned)IRQn,
+               (unsigned)Decoder->Depth);
+        if (Decoder->Depth != 0U)
+        {
+            Decoder->Depth--;
+        }
+    }
+
+    Decoder->Records++;
+    Decoder->Step = TRACEDECODE_TOKEN;
+}
+
+/**
+ * @brief Resolves the predicted IRQ of the current token, or waits for its IRQ byte.
+ */
+static void TraceDecode_Resolve(TraceDecode_t* Decoder)
+{
+    uint8_t Predicted = TRACEDECODE_NO_IRQ;
+
+    if ((Decoder->Flags & TRACEENC_FLAG_PREDICTED) == 0U)
+    {
+        Decoder->Step = TRACEDECODE_IRQ;
+        return;
+    }
+
+    if ((Decoder->Flags & TRACEENC_FLAG_EXIT) != 0U)
+    {
+        Predicted = (Decoder->Depth != 0U) ? Decoder->Stack[Decoder->Depth - 1U] : TRACEDECODE_NO_IRQ;
+    }
+    else
+    {
+        Predicted = Decoder->LastEnter;
+    }
+
+    if (Predicted == TRACEDECODE_NO_IRQ)
+    {
+        Decoder->Errors++;   /**< The encoder never predicts without state */
+        Decoder->Step = TRACEDECODE_TOKEN;
+        return;
+    }
+
+    TraceDecode_Record(Decoder, Predicted);
+}
+
+/**
+ * @brief Feeds one byte to the decoder.
+ */
+static void TraceDecode_Byte(TraceDecode_t* Decoder, uint8_t Byte)
+{
+    uint64_t Sync = 0U;
+
+    Decoder->Bytes++;
+
+    switch (Decoder->Step)
+    {
+    case TRACEDECODE_TOKEN:
+        Decoder->Flags = (uint8_t)(Byte & 3U);
+        Decoder->Delta = (uint32_t)Byte >> 2;
+        Decoder->Value = 0U;
+        Decoder->Bits = 0U;
+        if (Decoder->Delta == TRACEENC_DELTA_ESCAPE)
+        {
+            Decoder->Step = TRACEDECODE_VARINT;
+        }
+        else if (Decoder->Synced != 0U)
+        {
+            TraceDecode_Resolve(Decoder);
+        }
+        else
+        {
+            Decoder->Errors++;   /**< Record before the first SYNC: joined mid-stream */
+        }
+        break;
+
+    case TRACEDECODE_VARINT:
+        Decoder->Value |= (uint32_t)(Byte & 0x7FU) << Decoder->Bits;
+        Decoder->Bits += 7U;
+        if ((Byte & 0x80U) != 0U)
+        {
+            break;
+        }
+        Decoder->Bits = 0U;
+        if (Decoder->Value == TRACEENC_CTRL_SYNC)
+        {
+            Decoder->Value = 0U;
+            Decoder->Step = TRACEDECODE_SYNC;
+        }
+        else if (Decoder->Value == TRACEENC_CTRL_OVERRUN)
+        {
+            Decoder->Value = 0U;
+            Decoder->Step = TRACEDECODE_OVERRUN;
+        }
+        else if (Decoder->Value < TRACEENC_CTRL_CODES)
+        {
+            Decoder->Errors++;
+            Decoder->Step = TRACEDECODE_TOKEN;
+        }
+        else if (Decoder->Synced != 0U)
+        {
+            Decoder->Delta = (Decoder->Value - TRACEENC_CTRL_CODES) + TRACEENC_DELTA_ESCAPE;
+            TraceDecode_Resolve(Decoder);
+        }
+        else
+        {
+            Decoder->Errors++;
+            Decoder->Step = TRACEDECODE_TOKEN;
+        }
+        break;
+
+    case TRACEDECODE_IRQ:
+        TraceDecode_Record(Decoder, Byte);
+        break;
+
+    case TRACEDECODE_SYNC:
+        /* Shift byte, then the 32-bit timestamp, least significant byte first */
+        if (Decoder->Bits == 0U)
+        {
+            Decoder->Shift = Byte;
+        }
+        else
+        {
+            Decoder->Value |= (uint32_t)Byte << (8U * (Decoder->Bits - 1U));
+        }
+        Decoder->Bits++;
+        if (Decoder->Bits == 5U)
+        {
+            /* Keep the 64-bit clock monotonic across the 32-bit timestamp */
+            Sync = (Decoder->Clock & ~0xFFFFFFFFULL) | Decoder->Value;
+            if ((Decoder->Synced != 0U) && (Sync < Decoder->Clock))
+            {
+                Sync += 0x100000000ULL;
+            }
+            Decoder->Clock = Sync;
+            Decoder->Depth = 0U;
+            Decoder->LastEnter = TRACEDECODE_NO_IRQ;
+            Decoder->Synced = 1U;
+            printf("%12llu SYNC  unit %u cycles\n", (unsigned long long)Decoder->Clock, 1U << Decoder->Shift);
+            Decoder->Step = TRACEDECODE_TOKEN;
+        }
+        break;
+
+    case TRACEDECODE_OVERRUN:
+        Decoder->Value |= (uint32_t)(Byte & 0x7FU) << Decoder->Bits;
+        Decoder->Bits += 7U;
+        if ((Byte & 0x80U) == 0U)
+        {
+            Decoder->Lost += Decoder->Value;
+            printf("%12s LOST  %u records\n", "", (unsigned)Decoder->Value);
+            Decoder->Step = TRACEDECODE_TOKEN;
+        }
+        break;
+
+    default:
+        Decoder->Step = TRACEDECODE_TOKEN;
+        break;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    static TraceDecode_t Decoder;
+    uint8_t Chunk[256];
+    size_t Length = 0U;
+    size_t Index = 0U;
+    FILE* Input = stdin;
+
+    if ((argc > 1) && ((Input = fopen(argv[1], "rb")) == 0))
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    Decoder.LastEnter = TRACEDECODE_NO_IRQ;
+
+    while ((Length = fread(Chunk, 1U, sizeof(Chunk), Input)) != 0U)
+    {
+        for (Index = 0U; Index < Length; Index++)
+        {
+            TraceDecode_Byte(&Decoder, Chunk[Index]);
+        }
+        (void)fflush(stdout);
+    }
+
+    fprintf(stderr, "%llu records, %llu lost, %llu bytes (%.2f bytes/record, %.1fx smaller than raw), %llu errors\n",
+            (unsigned long long)Decoder.Records, (unsigned long long)Decoder.Lost, (unsigned long long)Decoder.Bytes,
+            (Decoder.Records != 0U) ? ((double)Decoder.Bytes / (double)Decoder.Records) : 0.0,
+            (Decoder.Bytes != 0U) ? ((8.0 * (double)Decoder.Records) / (double)Decoder.Bytes) : 0.0,
+            (unsigned long long)Decoder.Errors);
+
+    return 0;
+}